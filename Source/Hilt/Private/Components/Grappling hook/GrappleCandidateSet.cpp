@@ -0,0 +1,166 @@
+#include "Components/GrapplingHook/GrappleCandidateSet.h"
+
+#include "Engine/OverlapResult.h"
+
+void FGrappleCandidateSet::Refresh(const UWorld* World, const FVector& InCenter, const float InRadius, const ECollisionChannel Channel, const FCollisionQueryParams& Params, const int32 MaxCandidates)
+{
+	//clear the old candidates
+	Reset();
+
+	//set the area the set is gathered in
+	Center = InCenter;
+	Radius = InRadius;
+	RefreshTime = World->GetTimeSeconds();
+
+	//storage for the overlaps
+	TArray<FOverlapResult> Overlaps;
+
+	//get all the primitives that block or overlap the channel around the center
+	World->OverlapMultiByChannel(Overlaps, Center, FQuat::Identity, Channel, FCollisionShape::MakeSphere(Radius), Params);
+
+	//check if there are too many primitives for the set to be cheaper than a scene trace
+	if (MaxCandidates > 0 && Overlaps.Num() > MaxCandidates)
+	{
+		//return to prevent further execution (the set stays invalid so we fall back to scene traces)
+		return;
+	}
+
+	//iterate through all the overlaps
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		//check if the overlap has a valid component
+		if (UPrimitiveComponent* Component = Overlap.GetComponent())
+		{
+			//add the component to the candidates
+			Candidates.AddUnique(Component);
+		}
+	}
+
+	//set the set to be valid
+	bIsValid = true;
+}
+
+float FGrappleCandidateSet::GetExitDistance(const FVector& Start, const FVector& Direction) const
+{
+	//get the offset of the start from the center of the gathered sphere
+	const FVector Offset = Start - Center;
+
+	//get how far outside the sphere the start is (squared, negative when inside)
+	const float OutsideSquared = Offset.SizeSquared() - FMath::Square(Radius);
+
+	//check if the set is invalid or the start is outside the sphere
+	if (!bIsValid || OutsideSquared > 0)
+	{
+		return 0.f;
+	}
+
+	//get the projection of the offset onto the direction
+	const float Projection = Offset | Direction;
+
+	//return the distance to the far intersection of the ray and the sphere
+	return -Projection + FMath::Sqrt(FMath::Square(Projection) - OutsideSquared);
+}
+
+void FGrappleCandidateSet::Raycast(TArray<FHitResult>& OutHits, const FVector& Start, const FVector& End, const ECollisionChannel Channel, const FCollisionQueryParams& Params) const
+{
+	//clear the output hits
+	OutHits.Reset();
+
+	//get the length of the ray
+	const float Length = FVector::Dist(Start, End);
+
+	//storage for the candidates whose bounds the ray enters and how far along the ray it enters them
+	TArray<TPair<float, UPrimitiveComponent*>, TInlineAllocator<16>> BoundsHits;
+
+	//iterate through all the candidates
+	for (const TWeakObjectPtr<UPrimitiveComponent>& WeakCandidate : Candidates)
+	{
+		//get the candidate and check if it's still valid and has collision
+		UPrimitiveComponent* Candidate = WeakCandidate.Get();
+		if (!Candidate || !Candidate->IsQueryCollisionEnabled() || Candidate->GetCollisionResponseToChannel(Channel) == ECR_Ignore)
+		{
+			continue;
+		}
+
+		//storage for the bounds intersection
+		FVector HitLocation;
+		FVector HitNormal;
+		float HitTime;
+
+		//check if the ray enters the bounds of the candidate (the bounds are read every time so moving primitives are handled)
+		if (FMath::LineExtentBoxIntersection(Candidate->Bounds.GetBox(), Start, End, FVector::ZeroVector, HitLocation, HitNormal, HitTime))
+		{
+			//add the candidate to the bounds hits
+			BoundsHits.Emplace(HitTime * Length, Candidate);
+		}
+	}
+
+	//sort the bounds hits from closest to farthest
+	BoundsHits.Sort([](const TPair<float, UPrimitiveComponent*>& A, const TPair<float, UPrimitiveComponent*>& B) { return A.Key < B.Key; });
+
+	//storage for the closest blocking hit
+	FHitResult BlockingHit;
+	float BlockingDistance = TNumericLimits<float>::Max();
+
+	//iterate through the bounds hits
+	for (const TPair<float, UPrimitiveComponent*>& BoundsHit : BoundsHits)
+	{
+		//check if the bounds are farther away than the closest blocking hit (nothing after this can be closer)
+		if (BoundsHit.Key > BlockingDistance)
+		{
+			break;
+		}
+
+		//trace against the geometry of the candidate
+		FHitResult Hit;
+		if (!BoundsHit.Value->LineTraceComponent(Hit, Start, End, Params))
+		{
+			continue;
+		}
+
+		//set the trace start and end so the hit matches a scene trace
+		Hit.TraceStart = Start;
+		Hit.TraceEnd = End;
+
+		//check if the candidate blocks the channel
+		if (BoundsHit.Value->GetCollisionResponseToChannel(Channel) == ECR_Block)
+		{
+			//check if this is the closest blocking hit
+			if (Hit.Distance < BlockingDistance)
+			{
+				//set the closest blocking hit
+				BlockingHit = Hit;
+				BlockingHit.bBlockingHit = true;
+				BlockingDistance = Hit.Distance;
+			}
+		}
+		else
+		{
+			//add the overlap hit
+			Hit.bBlockingHit = false;
+			OutHits.Add(Hit);
+		}
+	}
+
+	//remove the overlap hits that are behind the closest blocking hit
+	OutHits.RemoveAll([BlockingDistance](const FHitResult& Hit) { return Hit.Distance > BlockingDistance; });
+
+	//sort the overlap hits from closest to farthest
+	OutHits.Sort([](const FHitResult& A, const FHitResult& B) { return A.Distance < B.Distance; });
+
+	//check if we have a blocking hit
+	if (BlockingHit.bBlockingHit)
+	{
+		//add the blocking hit last (same as a multi trace)
+		OutHits.Add(BlockingHit);
+	}
+}
+
+void FGrappleCandidateSet::Reset()
+{
+	//clear the candidates
+	Candidates.Reset();
+
+	//set the set to be invalid
+	bIsValid = false;
+}
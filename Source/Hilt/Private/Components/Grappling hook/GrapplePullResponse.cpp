@@ -0,0 +1,80 @@
+#include "Components/GrapplingHook/GrapplePullResponse.h"
+
+#include "Curves/CurveFloat.h"
+#include "Player/ScoreComponent.h"
+
+void FGrapplePullResponseTable::Bake(const FScoreValues& ScoreValues, const FIntVector& InResolution, const float InMaxNormalizedStep)
+{
+	//set the resolution (at least 2 samples per axis so we can interpolate)
+	Resolution = FIntVector(FMath::Max(2, InResolution.X), FMath::Max(2, InResolution.Y), FMath::Max(2, InResolution.Z));
+
+	//set the max normalized step
+	MaxNormalizedStep = FMath::Max(InMaxNormalizedStep, UE_KINDA_SMALL_NUMBER);
+
+	//allocate the values
+	Values.SetNumUninitialized(Resolution.X * Resolution.Y * Resolution.Z);
+
+	//iterate through all the samples
+	for (int Z = 0; Z < Resolution.Z; ++Z)
+	{
+		//get the normalized pull step of this sample
+		const float NormalizedStep = MaxNormalizedStep * Z / (Resolution.Z - 1);
+
+		for (int Y = 0; Y < Resolution.Y; ++Y)
+		{
+			//get the distance curve value of this sample (same as ApplyPullForce, 1 when there's no curve)
+			const float DistanceValue = ScoreValues.GrappleDistanceCurve ? ScoreValues.GrappleDistanceCurve->GetFloatValue(float(Y) / (Resolution.Y - 1)) : 1.f;
+
+			for (int X = 0; X < Resolution.X; ++X)
+			{
+				//get the angle curve value of this sample
+				const float AngleValue = ScoreValues.GrappleAngleCurve ? ScoreValues.GrappleAngleCurve->GetFloatValue(-1.f + 2.f * X / (Resolution.X - 1)) : 1.f;
+
+				//get the multiplier from the angle and distance curves
+				float Value = AngleValue * DistanceValue;
+
+				//check if we have a velocity curve
+				if (ScoreValues.GrappleVelocityCurve)
+				{
+					//get the velocity curve value using the speed of the already scaled pull step (clamped to the speed limit like ApplySpeedLimit does)
+					Value *= ScoreValues.GrappleVelocityCurve->GetFloatValue(FMath::Min(NormalizedStep * FMath::Abs(Value), 1.f));
+				}
+
+				//store the value
+				Values[X + Resolution.X * (Y + Resolution.Y * Z)] = Value;
+			}
+		}
+	}
+}
+
+float FGrapplePullResponseTable::Sample(const float AngleDot, const float NormalizedDistance, const float NormalizedStep) const
+{
+	//get the continuous sample coordinates of the inputs
+	const float FX = FMath::Clamp((AngleDot + 1.f) * 0.5f, 0.f, 1.f) * (Resolution.X - 1);
+	const float FY = FMath::Clamp(NormalizedDistance, 0.f, 1.f) * (Resolution.Y - 1);
+	const float FZ = FMath::Clamp(NormalizedStep / MaxNormalizedStep, 0.f, 1.f) * (Resolution.Z - 1);
+
+	//get the lower sample of each axis (clamped so the upper sample is always in the table)
+	const int X0 = FMath::Min(FMath::FloorToInt(FX), Resolution.X - 2);
+	const int Y0 = FMath::Min(FMath::FloorToInt(FY), Resolution.Y - 2);
+	const int Z0 = FMath::Min(FMath::FloorToInt(FZ), Resolution.Z - 2);
+
+	//get the interpolation alphas
+	const float AX = FX - X0;
+	const float AY = FY - Y0;
+	const float AZ = FZ - Z0;
+
+	//get the index of the lower corner and the strides of the y and z axes
+	const int Index = X0 + Resolution.X * (Y0 + Resolution.Y * Z0);
+	const int StrideY = Resolution.X;
+	const int StrideZ = Resolution.X * Resolution.Y;
+
+	//interpolate along x
+	const float C00 = FMath::Lerp(Values[Index], Values[Index + 1], AX);
+	const float C10 = FMath::Lerp(Values[Index + StrideY], Values[Index + StrideY + 1], AX);
+	const float C01 = FMath::Lerp(Values[Index + StrideZ], Values[Index + StrideZ + 1], AX);
+	const float C11 = FMath::Lerp(Values[Index + StrideY + StrideZ], Values[Index + StrideY + StrideZ + 1], AX);
+
+	//interpolate along y and then z
+	return FMath::Lerp(FMath::Lerp(C00, C10, AY), FMath::Lerp(C01, C11, AY), AZ);
+}
@@ -0,0 +1,140 @@
+#include "Components/GrapplingHook/GrappleReleaseSolver.h"
+
+FGrappleReleaseResult GrappleReleaseSolver::Solve(const FGrappleReleaseInput& Input)
+{
+	//storage for the result
+	FGrappleReleaseResult Result;
+
+	//get the number of candidates and the time step (at least 2 candidates so both releasing now and at the end are tested)
+	const int32 NumCandidates = FMath::Max(2, Input.NumCandidates);
+	const float DT = FMath::Max(Input.TimeStep, UE_KINDA_SMALL_NUMBER);
+
+	//get the number of steps to simulate
+	const int32 NumSteps = FMath::CeilToInt((Input.PredictionTime + Input.FallTime) / DT);
+
+	//get the speed the velocity is clamped to
+	const float SpeedCap = FMath::Min(Input.SpeedLimit, Input.MaxSpeed);
+
+	//storage for the state of every candidate (one array per component so every candidate is stepped together)
+	TArray<float> PX, PY, PZ, VX, VY, VZ, ReleaseTimes;
+	TArray<bool> Released;
+	TArray<FVector> ReleaseLocations, ReleaseVelocities;
+	PX.Init(Input.Location.X, NumCandidates);
+	PY.Init(Input.Location.Y, NumCandidates);
+	PZ.Init(Input.Location.Z, NumCandidates);
+	VX.Init(Input.Velocity.X, NumCandidates);
+	VY.Init(Input.Velocity.Y, NumCandidates);
+	VZ.Init(Input.Velocity.Z, NumCandidates);
+	Released.Init(false, NumCandidates);
+	ReleaseLocations.Init(Input.Location, NumCandidates);
+	ReleaseVelocities.Init(Input.Velocity, NumCandidates);
+	ReleaseTimes.SetNumUninitialized(NumCandidates);
+
+	//spread the release times evenly over the prediction time
+	for (int Index = 0; Index < NumCandidates; ++Index)
+	{
+		ReleaseTimes[Index] = Input.PredictionTime * Index / (NumCandidates - 1);
+	}
+
+	//iterate through all the steps
+	for (int Step = 0; Step < NumSteps; ++Step)
+	{
+		//get the time of this step
+		const float Time = Step * DT;
+
+		//iterate through all the candidates
+		for (int Index = 0; Index < NumCandidates; ++Index)
+		{
+			//get the vector from the player to the anchor
+			const FVector ToAnchor = Input.Anchor - FVector(PX[Index], PY[Index], PZ[Index]);
+			const float Distance = ToAnchor.Size();
+
+			//check if this candidate should release now (either at its release time or because the grapple would stop by itself)
+			if (!Released[Index] && (Time >= ReleaseTimes[Index] || Distance < Input.StopDistance))
+			{
+				//release the grapple and store the release state
+				Released[Index] = true;
+				ReleaseTimes[Index] = Time;
+				ReleaseLocations[Index] = FVector(PX[Index], PY[Index], PZ[Index]);
+				ReleaseVelocities[Index] = FVector(VX[Index], VY[Index], VZ[Index]);
+			}
+
+			//storage for the new velocity
+			FVector Velocity(VX[Index], VY[Index], VZ[Index]);
+
+			//check if the candidate has released
+			if (Released[Index])
+			{
+				//apply falling gravity
+				Velocity.Z += Input.FallingGravityZ * DT;
+			}
+			else
+			{
+				//get the direction to the anchor
+				const FVector Direction = Distance > 0 ? ToAnchor / Distance : FVector::ZeroVector;
+
+				//check if we're interpolating the velocity
+				if (Input.bInterpVelocity)
+				{
+					//get the target velocity
+					const FVector Target = Direction * Input.PullSpeed;
+
+					//interpolate the velocity (same as DoInterpGrapple)
+					Velocity = Input.InterpMode == Constant ? FMath::VInterpConstantTo(Velocity, Target, DT, Input.PullAccel) : FMath::VInterpTo(Velocity, Target, DT, Input.PullAccel);
+				}
+				else
+				{
+					//get the pull step (same as ApplyPullForce)
+					const FVector PullStep = Direction * Input.PullSpeed * DT;
+
+					//get the pull force multiplier from the table (if we have one)
+					const float Multiplier = Input.PullResponseTable.IsValid() ? Input.PullResponseTable.Sample(FVector::DotProduct(Velocity.GetSafeNormal(), Direction), FMath::Clamp(Distance / Input.MaxGrappleDistance, 0.f, 1.f), PullStep.Size() / FMath::Max(Input.SpeedLimit, UE_KINDA_SMALL_NUMBER)) : Input.PullMultiplier;
+
+					//add the pull to the velocity
+					Velocity += PullStep * Multiplier;
+				}
+
+				//apply the gravity while grappling
+				Velocity.Z += Input.GrappleGravityZ * DT;
+
+				//clamp the velocity to the speed cap
+				Velocity = Velocity.GetClampedToMaxSize(SpeedCap);
+			}
+
+			//store the new velocity
+			VX[Index] = Velocity.X;
+			VY[Index] = Velocity.Y;
+			VZ[Index] = Velocity.Z;
+
+			//move the candidate
+			PX[Index] += VX[Index] * DT;
+			PY[Index] += VY[Index] * DT;
+			PZ[Index] += VZ[Index] * DT;
+		}
+	}
+
+	//iterate through all the candidates to find the best one
+	for (int Index = 0; Index < NumCandidates; ++Index)
+	{
+		//get the end location of the candidate
+		const FVector EndLocation(PX[Index], PY[Index], PZ[Index]);
+
+		//get the score of the candidate
+		const float Score = Input.Objective == MaximizeReleaseSpeed ? ReleaseVelocities[Index].Size() : FVector::Dist2D(Input.Location, EndLocation);
+
+		//check if this is the best candidate so far
+		if (!Result.bIsValid || Score > Result.Score)
+		{
+			//set the result
+			Result.bIsValid = true;
+			Result.ReleaseDelay = ReleaseTimes[Index];
+			Result.ReleaseLocation = ReleaseLocations[Index];
+			Result.ReleaseVelocity = ReleaseVelocities[Index];
+			Result.EndLocation = EndLocation;
+			Result.Score = Score;
+		}
+	}
+
+	//return the result
+	return Result;
+}
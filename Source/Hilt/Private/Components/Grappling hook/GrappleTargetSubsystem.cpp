@@ -0,0 +1,230 @@
+#include "Components/GrapplingHook/GrappleTargetSubsystem.h"
+
+#include "NPC/Components/GrappleableComponent.h"
+
+UGrappleTargetSubsystem::UGrappleTargetSubsystem()
+{
+}
+
+void UGrappleTargetSubsystem::Tick(float DeltaTime)
+{
+	//call the parent implementation
+	Super::Tick(DeltaTime);
+
+	//add the delta time to the time since the last rebucket
+	TimeSinceRebucket += DeltaTime;
+
+	//check if it's time to rebucket the targets
+	if (TimeSinceRebucket >= RebucketInterval)
+	{
+		//reset the time since the last rebucket
+		TimeSinceRebucket = 0;
+
+		//move the targets to their current cells
+		Rebucket();
+	}
+}
+
+TStatId UGrappleTargetSubsystem::GetStatId() const
+{
+	return TStatId();
+}
+
+void UGrappleTargetSubsystem::Deinitialize()
+{
+	//clear the grid
+	Cells.Empty();
+	TargetCells.Empty();
+
+	//call the parent implementation
+	Super::Deinitialize();
+}
+
+void UGrappleTargetSubsystem::RegisterTarget(UGrappleableComponent* Target)
+{
+	//check if the target is invalid or already registered
+	if (!Target || TargetCells.Contains(Target))
+	{
+		return;
+	}
+
+	//get the cell of the target
+	const FIntVector Cell = GetCell(Target->GetComponentLocation());
+
+	//add the target to the cell
+	Cells.FindOrAdd(Cell).Add(Target);
+	TargetCells.Add(Target, Cell);
+}
+
+void UGrappleTargetSubsystem::UnregisterTarget(UGrappleableComponent* Target)
+{
+	//check if the target is registered
+	if (const FIntVector* Cell = TargetCells.Find(Target))
+	{
+		//remove the target from its cell
+		RemoveFromCell(Target, *Cell);
+
+		//remove the target from the registered targets
+		TargetCells.Remove(Target);
+	}
+}
+
+UGrappleableComponent* UGrappleTargetSubsystem::FindBestTarget(const FGrappleTargetQuery& Query, const FCollisionQueryParams& Params, FHitResult& OutHit) const
+{
+	//get the ranked targets
+	TArray<UGrappleableComponent*> RankedTargets;
+	GetRankedTargets(Query, RankedTargets);
+
+	//iterate through the best ranked targets (only tracing as many as we're allowed to)
+	for (int Index = 0; Index < FMath::Min(RankedTargets.Num(), FMath::Max(1, Query.MaxVisibilityTraces)); ++Index)
+	{
+		//get the target
+		UGrappleableComponent* Target = RankedTargets[Index];
+
+		//trace to the target (slightly past it so we hit the surface it's on)
+		FHitResult Hit;
+		const FVector TargetLocation = Target->GetComponentLocation();
+		GetWorld()->LineTraceSingleByChannel(Hit, Query.Origin, TargetLocation + (TargetLocation - Query.Origin).GetSafeNormal() * 100, Query.TraceChannel, Params);
+
+		//check if the trace hit the target's actor
+		if (Hit.bBlockingHit && Hit.GetActor() == Target->GetOwner())
+		{
+			//set the output hit
+			OutHit = Hit;
+
+			//return the target
+			return Target;
+		}
+	}
+
+	//no visible target was found
+	return nullptr;
+}
+
+void UGrappleTargetSubsystem::GetRankedTargets(const FGrappleTargetQuery& Query, TArray<UGrappleableComponent*>& OutTargets) const
+{
+	//clear the output targets
+	OutTargets.Reset();
+
+	//get the normalized direction and the cosine of the cone angle
+	const FVector Direction = Query.Direction.GetSafeNormal();
+	const float MinDot = FMath::Cos(FMath::DegreesToRadians(Query.ConeHalfAngle));
+
+	//get the bounds of the cone (the segment along the direction expanded by the cone's widest radius)
+	const FVector End = Query.Origin + Direction * Query.MaxDistance;
+	const float ConeRadius = Query.MaxDistance * FMath::Sin(FMath::DegreesToRadians(FMath::Min(Query.ConeHalfAngle, 90.f)));
+	const FBox ConeBounds = FBox(Query.Origin.ComponentMin(End), Query.Origin.ComponentMax(End)).ExpandBy(ConeRadius);
+
+	//get the cells the bounds cover
+	const FIntVector MinCell = GetCell(ConeBounds.Min);
+	const FIntVector MaxCell = GetCell(ConeBounds.Max);
+
+	//storage for the scored targets
+	TArray<TPair<float, UGrappleableComponent*>, TInlineAllocator<16>> ScoredTargets;
+
+	//iterate through the cells the bounds cover
+	for (int X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				//get the targets of the cell
+				const TArray<TWeakObjectPtr<UGrappleableComponent>>* CellTargets = Cells.Find(FIntVector(X, Y, Z));
+				if (!CellTargets)
+				{
+					continue;
+				}
+
+				//iterate through the targets of the cell
+				for (const TWeakObjectPtr<UGrappleableComponent>& WeakTarget : *CellTargets)
+				{
+					//get the target and check if it's valid and not already grappled
+					UGrappleableComponent* Target = WeakTarget.Get();
+					if (!Target || Target->bIsGrappled)
+					{
+						continue;
+					}
+
+					//get the direction and distance to the target
+					FVector ToTarget;
+					float Distance;
+					(Target->GetComponentLocation() - Query.Origin).ToDirectionAndLength(ToTarget, Distance);
+
+					//get the dot product of the query direction and the direction to the target
+					const float Dot = FVector::DotProduct(Direction, ToTarget);
+
+					//check if the target is outside of the cone
+					if (Distance > Query.MaxDistance || Dot < MinDot)
+					{
+						continue;
+					}
+
+					//get how close the target is to the center of the cone (1 = center, 0 = edge) and how close it is to the origin (1 = origin, 0 = max distance)
+					const float AngleScore = MinDot < 1 ? (Dot - MinDot) / (1 - MinDot) : 1;
+					const float DistanceScore = 1 - Distance / Query.MaxDistance;
+
+					//add the target to the scored targets
+					ScoredTargets.Emplace(AngleScore * Query.AngleWeight + DistanceScore * Query.DistanceWeight, Target);
+				}
+			}
+		}
+	}
+
+	//sort the targets from best to worst
+	ScoredTargets.Sort([](const TPair<float, UGrappleableComponent*>& A, const TPair<float, UGrappleableComponent*>& B) { return A.Key > B.Key; });
+
+	//add the targets to the output targets
+	for (const TPair<float, UGrappleableComponent*>& ScoredTarget : ScoredTargets)
+	{
+		OutTargets.Add(ScoredTarget.Value);
+	}
+}
+
+FIntVector UGrappleTargetSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntVector(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize), FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void UGrappleTargetSubsystem::RemoveFromCell(const TWeakObjectPtr<UGrappleableComponent>& Target, const FIntVector& Cell)
+{
+	//get the targets of the cell
+	if (TArray<TWeakObjectPtr<UGrappleableComponent>>* CellTargets = Cells.Find(Cell))
+	{
+		//remove the target from the cell
+		CellTargets->RemoveSingleSwap(Target);
+
+		//check if the cell is empty
+		if (CellTargets->IsEmpty())
+		{
+			//remove the cell
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+void UGrappleTargetSubsystem::Rebucket()
+{
+	//iterate through all the registered targets
+	for (auto It = TargetCells.CreateIterator(); It; ++It)
+	{
+		//get the target and check if it's no longer valid (destroyed without unregistering)
+		const UGrappleableComponent* Target = It.Key().Get();
+		if (!Target)
+		{
+			//remove the target from its cell and the registered targets
+			RemoveFromCell(It.Key(), It.Value());
+			It.RemoveCurrent();
+			continue;
+		}
+
+		//get the current cell of the target and check if it has changed
+		if (const FIntVector NewCell = GetCell(Target->GetComponentLocation()); NewCell != It.Value())
+		{
+			//move the target to the new cell
+			RemoveFromCell(It.Key(), It.Value());
+			Cells.FindOrAdd(NewCell).Add(It.Key());
+			It.Value() = NewCell;
+		}
+	}
+}
@@ -1,5 +1,6 @@
 #include "Components/GrapplingHook/GrapplingComponent.h"
 
+#include "Async/Async.h"
 #include "Components/CapsuleComponent.h"
 #include "NPC/Components/GrappleableComponent.h"
 #include "Components/PlayerMovementComponent.h"
@@ -33,6 +34,16 @@ void UGrapplingComponent::BeginPlay()
 	//setup start and stop grapple events for the rope component
 	OnStartGrapple.AddDynamic(RopeComponent, &URopeComponent::ActivateRope);
 	OnStopGrapple.AddDynamic(RopeComponent, &URopeComponent::DeactivateRope);
+
+	//subscribe to score tier changes
+	PlayerCharacter->ScoreComponent->OnScoreTierChanged.AddDynamic(this, &UGrapplingComponent::OnScoreTierChanged);
+
+	//check if we should use the pull response tables
+	if (bUsePullResponseTable)
+	{
+		//bake the pull response tables
+		BakePullResponseTables();
+	}
 }
 
 void UGrapplingComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -43,6 +54,18 @@ void UGrapplingComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
 	//update the can grapple variable
 	CanGrappleVar = CanGrapple(false);
 
+	//check if we aren't aiming directly at something and aren't grappling
+	if (!CanGrappleVar && !bIsGrappling)
+	{
+		//use the aim assist target instead (if any)
+		CanGrappleVar = UpdateAimAssistTarget();
+	}
+	else
+	{
+		//clear the aim assist target
+		AimAssistTarget = nullptr;
+	}
+
 	//check if we're grappling
 	if (bIsGrappling)
 	{
@@ -267,8 +290,25 @@ void UGrapplingComponent::StopGrapple(bool CallBlueprintEvent)
 
 void UGrapplingComponent::StartGrappleCheck()
 {
-	//check if we're already grappling or if we can't grapple
-	if (bIsGrappling || !CanGrapple(true))
+	//check if we're already grappling
+	if (bIsGrappling)
+	{
+		//return early
+		return;
+	}
+
+	//check if we aren't aiming directly at something and have an aim assist target
+	if (bUseAimAssist && !CanGrapple(false) && UpdateAimAssistTarget())
+	{
+		//start grappling to the aim assist target
+		StartGrapple(AimAssistHit);
+
+		//return early
+		return;
+	}
+
+	//check if we can't grapple
+	if (!CanGrapple(true))
 	{
 		//return early
 		return;
@@ -314,6 +354,85 @@ void UGrapplingComponent::StopGrappleCheck()
 	}
 }
 
+bool UGrapplingComponent::SolveReleaseAsync(const TEnumAsByte<EGrappleReleaseObjective> Objective)
+{
+	//check if we aren't grappling or are already solving
+	if (!bIsGrappling || bIsSolvingRelease)
+	{
+		return false;
+	}
+
+	//storage for the solver input (everything is copied here so the worker thread never touches any uobjects)
+	FGrappleReleaseInput Input;
+
+	//set the rope and player state
+	Input.Anchor = RopeComponent->GetRopeEnd();
+	Input.Location = GetOwner()->GetActorLocation();
+	Input.Velocity = PlayerCharacter->PlayerMovementComponent->Velocity;
+
+	//set the grapple mode and pull
+	Input.bInterpVelocity = GetGrappleMode() == InterpVelocity;
+	Input.PullSpeed = Input.bInterpVelocity ? GetGrappleInterpStruct().PullSpeed : GetPullSpeed();
+	Input.PullAccel = GetGrappleInterpStruct().PullAccel;
+	Input.InterpMode = GetGrappleInterpStruct().InterpMode;
+
+	//check if we have a pull response table for the current tier
+	if (PullResponseTables.IsValidIndex(PlayerCharacter->ScoreComponent->GetCurrentScoreTier()))
+	{
+		//copy the pull response table
+		Input.PullResponseTable = PullResponseTables[PlayerCharacter->ScoreComponent->GetCurrentScoreTier()];
+	}
+	else
+	{
+		//use the current pull force multiplier for the whole prediction
+		Input.PullMultiplier = GetPullForceMultiplier(GrappleDirection * GetPullSpeed() * ReleaseTimeStep, ReleaseTimeStep);
+	}
+
+	//set the limits
+	Input.MaxGrappleDistance = MaxGrappleDistance;
+	Input.StopDistance = GrappleStopDistance;
+	Input.SpeedLimit = PlayerCharacter->PlayerMovementComponent->GetCurrentSpeedLimit();
+	Input.MaxSpeed = GetMaxSpeed();
+
+	//set the gravity while grappling and after releasing
+	Input.GrappleGravityZ = bApplyGravityWhenGrappling ? GetWorld()->GetGravityZ() * PlayerCharacter->ScoreComponent->GetCurrentScoreValues().GravityScale : 0;
+	Input.FallingGravityZ = GetWorld()->GetGravityZ() * PlayerCharacter->PlayerMovementComponent->DefaultGravityScale;
+
+	//set the prediction settings
+	Input.PredictionTime = ReleasePredictionTime;
+	Input.FallTime = ReleaseFallTime;
+	Input.TimeStep = ReleaseTimeStep;
+	Input.NumCandidates = NumReleaseCandidates;
+	Input.Objective = Objective;
+
+	//set that we're solving
+	bIsSolvingRelease = true;
+
+	//solve on a worker thread
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis = TWeakObjectPtr<UGrapplingComponent>(this), Input = MoveTemp(Input)]
+	{
+		//solve for the best release
+		const FGrappleReleaseResult Result = GrappleReleaseSolver::Solve(Input);
+
+		//report the result back on the game thread
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Result]
+		{
+			//check if the component still exists
+			if (UGrapplingComponent* This = WeakThis.Get())
+			{
+				//set that we're no longer solving
+				This->bIsSolvingRelease = false;
+
+				//broadcast the result
+				This->OnReleaseSolved.Broadcast(Result);
+			}
+		});
+	});
+
+	//return that the solver was started
+	return true;
+}
+
 FVector UGrapplingComponent::ProcessGrappleInput(FVector MovementInput)
 {
 	GrappleInput = MovementInput;
@@ -479,8 +598,12 @@ void UGrapplingComponent::DoGrappleTrace(float MaxDistance, bool DoSphereTrace)
 	//storage for the temp array
 	TArray<FHitResult> TempArray;
 
-	//do the line trace
-	GetWorld()->LineTraceMultiByChannel(TempArray, CameraLocation, End, RopeComponent->CollisionChannel, GrappleCollisionParams);
+	//check if we can't use the candidate set (never used for the sphere trace so the actual grapple always uses the scene)
+	if (DoSphereTrace || !DoCandidateGrappleTrace(TempArray, CameraLocation, Rotation, MaxDistance))
+	{
+		//do the line trace
+		GetWorld()->LineTraceMultiByChannel(TempArray, CameraLocation, End, RopeComponent->CollisionChannel, GrappleCollisionParams);
+	}
 
 	//check if the temp array is empty and we're doing a sphere trace
 	if (TempArray.IsEmpty() && DoSphereTrace)
@@ -505,6 +628,133 @@ void UGrapplingComponent::DoGrappleTrace(float MaxDistance, bool DoSphereTrace)
 	}
 }
 
+bool UGrapplingComponent::UpdateAimAssistTarget()
+{
+	//reset the aim assist target
+	AimAssistTarget = nullptr;
+
+	//check if we shouldn't use aim assist
+	if (!bUseAimAssist)
+	{
+		return false;
+	}
+
+	//get the grapple target subsystem
+	const UGrappleTargetSubsystem* GrappleTargetSubsystem = GetWorld()->GetSubsystem<UGrappleTargetSubsystem>();
+	if (!GrappleTargetSubsystem)
+	{
+		return false;
+	}
+
+	//storage for camera location and rotation
+	FVector CameraLocation;
+	FRotator CameraRotation;
+
+	//set the camera location and rotation
+	GetOwner()->GetNetOwningPlayer()->GetPlayerController(GetWorld())->GetPlayerViewPoint(CameraLocation, CameraRotation);
+
+	//setup the query from the camera
+	FGrappleTargetQuery Query = AimAssistQuery;
+	Query.Origin = CameraLocation;
+	Query.Direction = CameraRotation.Vector();
+	Query.MaxDistance = MaxGrappleDistance;
+	Query.TraceChannel = RopeComponent->CollisionChannel;
+
+	//find the best target
+	AimAssistTarget = GrappleTargetSubsystem->FindBestTarget(Query, RopeComponent->GetCollisionParams(), AimAssistHit);
+
+	//return whether or not we found a target
+	return AimAssistTarget != nullptr;
+}
+
+bool UGrapplingComponent::DoCandidateGrappleTrace(TArray<FHitResult>& OutHits, const FVector& CameraLocation, const FVector& Direction, const float MaxDistance)
+{
+	//check if we shouldn't use the candidate set
+	if (!bUseGrappleCandidates)
+	{
+		return false;
+	}
+
+	//get the longest distance we check (so the ray can be shared between the can grapple check and the remaining distance check)
+	const float RayDistance = FMath::Max3(MaxDistance, MaxGrappleDistance, MaxGrappleCheckDistance);
+
+	//check if the set is due a refresh or if the camera has moved too far from where it was gathered (an invalid set only refreshes on the interval so we don't overlap every frame)
+	if (GetWorld()->GetTimeSeconds() - GrappleCandidates.RefreshTime >= GrappleCandidateRefreshInterval || (GrappleCandidates.bIsValid && FVector::Dist(CameraLocation, GrappleCandidates.Center) > GrappleCandidateRadiusMargin))
+	{
+		//regather the primitives near the camera
+		GrappleCandidates.Refresh(GetWorld(), CameraLocation, GrappleCandidateRadius, RopeComponent->CollisionChannel, RopeComponent->GetCollisionParams(), MaxGrappleCandidates);
+
+		//invalidate the cached ray
+		CandidateRayFrame = 0;
+	}
+
+	//get how far the ray stays inside the gathered area
+	const float ExitDistance = FMath::Min(GrappleCandidates.GetExitDistance(CameraLocation, Direction), RayDistance);
+
+	//check if the camera isn't inside the gathered area
+	if (ExitDistance <= 0)
+	{
+		return false;
+	}
+
+	//check if we haven't traced the camera ray this frame
+	if (CandidateRayFrame != GFrameCounter)
+	{
+		//trace the part of the camera ray inside the gathered area against the set
+		GrappleCandidates.Raycast(CandidateRayHits, CameraLocation, CameraLocation + Direction * ExitDistance, RopeComponent->CollisionChannel, RopeComponent->GetCollisionParams());
+
+		//check if the ray leaves the gathered area without being blocked
+		if (ExitDistance < RayDistance && (CandidateRayHits.IsEmpty() || !CandidateRayHits.Last().bBlockingHit))
+		{
+			//trace the rest of the ray against the scene
+			const FVector End = CameraLocation + Direction * RayDistance;
+			const int32 NumCandidateHits = CandidateRayHits.Num();
+			TArray<FHitResult> SceneHits;
+			GetWorld()->LineTraceMultiByChannel(SceneHits, CameraLocation + Direction * ExitDistance, End, RopeComponent->CollisionChannel, RopeComponent->GetCollisionParams());
+			CandidateRayHits.Append(SceneHits);
+
+			//set the scene hits to be relative to the camera so they match the hits of a single trace
+			for (int32 Index = NumCandidateHits; Index < CandidateRayHits.Num(); ++Index)
+			{
+				FHitResult& Hit = CandidateRayHits[Index];
+				Hit.Distance += ExitDistance;
+				Hit.Time = Hit.Distance / RayDistance;
+				Hit.TraceStart = CameraLocation;
+				Hit.TraceEnd = End;
+			}
+		}
+		else
+		{
+			//set the ends of the hits to the end of the whole ray so they match the hits of a single trace
+			for (FHitResult& Hit : CandidateRayHits)
+			{
+				Hit.TraceEnd = CameraLocation + Direction * RayDistance;
+				Hit.Time = Hit.Distance / RayDistance;
+			}
+		}
+
+		//set the frame the ray was traced on
+		CandidateRayFrame = GFrameCounter;
+	}
+
+	//clear the output hits
+	OutHits.Reset();
+
+	//iterate through the cached hits
+	for (const FHitResult& Hit : CandidateRayHits)
+	{
+		//check if the hit is within the max distance
+		if (Hit.Distance <= MaxDistance)
+		{
+			//add the hit to the output hits
+			OutHits.Add(Hit);
+		}
+	}
+
+	//return that the candidate set was used
+	return true;
+}
+
 void UGrapplingComponent::CheckTargetForceModifiers(FVector& BaseVel, float DeltaTime) const
 {
 	//check if we have a valid grappleable component
@@ -547,35 +797,8 @@ void UGrapplingComponent::ApplyPullForce(float DeltaTime)
 	switch (GetGrappleMode())
 	{
 		case AddToVelocity:
-			//check if we have a valid angle curve
-			if (PlayerCharacter->ScoreComponent->GetCurrentScoreValues().GrappleAngleCurve)
-			{
-				//get the grapple angle curve value
-				const float Value = PlayerCharacter->ScoreComponent->GetCurrentScoreValues().GrappleAngleCurve->GetFloatValue(GetGrappleDotProduct(GrappleVelocity.GetSafeNormal()));
-
-				//multiply the grapple velocity by the grapple curve value
-				GrappleVelocity *= Value;
-			}
-
-			//check if we have a valid distance curve
-			if (PlayerCharacter->ScoreComponent->GetCurrentScoreValues().GrappleDistanceCurve)
-			{
-				//get the grapple distance curve value
-				const float Value = PlayerCharacter->ScoreComponent->GetCurrentScoreValues().GrappleDistanceCurve->GetFloatValue(FMath::Clamp(FVector::Dist(GetOwner()->GetActorLocation(), RopeComponent->GetRopeEnd()) / MaxGrappleDistance, 0, 1));
-				 
-				//multiply the grapple velocity by the grapple distance curve value
-				GrappleVelocity *= Value;
-			}
-
-			//check if we have a valid GrappleVelocityCurve and GrappleVelocityDotProductCurve
-			if (PlayerCharacter->ScoreComponent->GetCurrentScoreValues().GrappleVelocityCurve)
-			{
-				//get the grapple velocity curve value
-				const float VelocityValue = PlayerCharacter->ScoreComponent->GetCurrentScoreValues().GrappleVelocityCurve->GetFloatValue(PlayerCharacter->PlayerMovementComponent->ApplySpeedLimit(GrappleVelocity, DeltaTime, false).Size() / PlayerCharacter->PlayerMovementComponent->GetCurrentSpeedLimit());
-				
-				//multiply the grapple velocity by the grapple velocity curve value
-				GrappleVelocity *= VelocityValue;
-			}
+			//multiply the grapple velocity by the angle, distance and velocity curve values
+			GrappleVelocity *= GetPullForceMultiplier(GrappleVelocity, DeltaTime);
 
 			//calculate the grapple dot product
 			GrappleDotProduct = GetGrappleDotProduct(GrappleVelocity);
@@ -605,6 +828,16 @@ void UGrapplingComponent::OnGrappleTargetDestroyed(AActor* DestroyedActor)
 	StopGrapple();
 }
 
+void UGrapplingComponent::OnScoreTierChanged(int32 NewTier, int32 OldTier)
+{
+	//check if we're grappling with gravity (the gravity scale is per score tier)
+	if (bIsGrappling && bApplyGravityWhenGrappling)
+	{
+		//set the gravity scale of the new tier
+		PlayerCharacter->PlayerMovementComponent->GravityScale = PlayerCharacter->ScoreComponent->GetCurrentScoreValues().GravityScale;
+	}
+}
+
 FGrappleInterpStruct UGrapplingComponent::GetGrappleInterpStruct() const
 {
 	//check if we have a valid grappleable component
@@ -639,6 +872,74 @@ TEnumAsByte<EGrapplingMode> UGrapplingComponent::GetGrappleMode() const
 	return GrappleMode;
 }
 
+float UGrapplingComponent::GetPullForceMultiplier(const FVector& GrappleVelocity, const float DeltaTime) const
+{
+	//get the current score values
+	const FScoreValues& ScoreValues = PlayerCharacter->ScoreComponent->GetCurrentScoreValues();
+
+	//get the dot product of the player's velocity and the grapple velocity
+	const float DotProduct = GetGrappleDotProduct(GrappleVelocity.GetSafeNormal());
+
+	//get the rope length relative to the max grapple distance
+	const float NormalizedDistance = FMath::Clamp(FVector::Dist(GetOwner()->GetActorLocation(), RopeComponent->GetRopeEnd()) / MaxGrappleDistance, 0, 1);
+
+	//check if we should use the pull response table of the current tier
+	if (bUsePullResponseTable && PullResponseTables.IsValidIndex(PlayerCharacter->ScoreComponent->GetCurrentScoreTier()))
+	{
+		//get the pull step relative to the speed limit
+		const float NormalizedStep = GrappleVelocity.Size() / FMath::Max(PlayerCharacter->PlayerMovementComponent->GetCurrentSpeedLimit(), UE_KINDA_SMALL_NUMBER);
+
+		//return the multiplier from the table
+		return PullResponseTables[PlayerCharacter->ScoreComponent->GetCurrentScoreTier()].Sample(DotProduct, NormalizedDistance, NormalizedStep);
+	}
+
+	//storage for the multiplier
+	float Multiplier = 1;
+
+	//check if we have a valid angle curve
+	if (ScoreValues.GrappleAngleCurve)
+	{
+		//multiply by the grapple angle curve value
+		Multiplier *= ScoreValues.GrappleAngleCurve->GetFloatValue(DotProduct);
+	}
+
+	//check if we have a valid distance curve
+	if (ScoreValues.GrappleDistanceCurve)
+	{
+		//multiply by the grapple distance curve value
+		Multiplier *= ScoreValues.GrappleDistanceCurve->GetFloatValue(NormalizedDistance);
+	}
+
+	//check if we have a valid GrappleVelocityCurve
+	if (ScoreValues.GrappleVelocityCurve)
+	{
+		//multiply by the grapple velocity curve value (using the grapple velocity scaled by the angle and distance curves)
+		Multiplier *= ScoreValues.GrappleVelocityCurve->GetFloatValue(PlayerCharacter->PlayerMovementComponent->ApplySpeedLimit(GrappleVelocity * Multiplier, DeltaTime, false).Size() / PlayerCharacter->PlayerMovementComponent->GetCurrentSpeedLimit());
+	}
+
+	//return the multiplier
+	return Multiplier;
+}
+
+void UGrapplingComponent::BakePullResponseTables()
+{
+	//clear the old tables
+	PullResponseTables.Reset();
+
+	//check if we have a valid player character
+	if (!PlayerCharacter || !PlayerCharacter->ScoreComponent)
+	{
+		return;
+	}
+
+	//iterate through all the score values
+	for (const FScoreValues& ScoreValues : PlayerCharacter->ScoreComponent->ScoreValues)
+	{
+		//bake the table of this tier
+		PullResponseTables.AddDefaulted_GetRef().Bake(ScoreValues, PullResponseTableResolution, PullResponseMaxNormalizedStep);
+	}
+}
+
 float UGrapplingComponent::GetGrappleDotProduct(FVector GrappleVelocity) const
 {
 	//get the dot product of the owner's velocity and the grapple velocity
@@ -0,0 +1,200 @@
+#include "Components/GrapplingHook/RopeBenchmarkCommandlet.h"
+
+#include "Components/GrapplingHook/RopeComponent.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+URopeBenchmarkCommandlet::URopeBenchmarkCommandlet()
+{
+	//run without the editor ui or rendering
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 URopeBenchmarkCommandlet::Main(const FString& Params)
+{
+	//get the number of frames to run each scenario for
+	int32 NumFrames = 300;
+	FParse::Value(*Params, TEXT("Frames="), NumFrames);
+	NumFrames = FMath::Max(1, NumFrames);
+
+	//get the scenario to run (all scenarios if empty)
+	FString ScenarioFilter;
+	FParse::Value(*Params, TEXT("Scenario="), ScenarioFilter);
+
+	//storage for the csv output
+	FString Csv = TEXT("Scenario,AverageFrameMs,MaxFrameMs,QueriesPerFrame,Allocations,FinalRopePoints\n");
+
+	//iterate through all the scenarios
+	for (const FRopeBenchmarkScenario& Scenario : GetScenarios())
+	{
+		//check if we should skip this scenario
+		if (!ScenarioFilter.IsEmpty() && Scenario.Name != ScenarioFilter)
+		{
+			continue;
+		}
+
+		//run the scenario
+		const FRopeBenchmarkResult Result = RunScenario(Scenario, NumFrames);
+
+		//report the result
+		UE_LOG(LogTemp, Display, TEXT("RopeBenchmark %-20s avg %.4f ms  max %.4f ms  %.1f queries/frame  %d allocations  %d points"), *Scenario.Name, Result.AverageFrameMs, Result.MaxFrameMs, Result.QueriesPerFrame, Result.Allocations, Result.FinalRopePoints);
+
+		//add the result to the csv
+		Csv += FString::Printf(TEXT("%s,%f,%f,%f,%d,%d\n"), *Scenario.Name, Result.AverageFrameMs, Result.MaxFrameMs, Result.QueriesPerFrame, Result.Allocations, Result.FinalRopePoints);
+	}
+
+	//check if we should write the csv
+	if (FParse::Param(*Params, TEXT("Csv")))
+	{
+		//get the path of the csv
+		const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("RopeBenchmark_%s.csv"), *FDateTime::Now().ToString());
+
+		//write the csv
+		FFileHelper::SaveStringToFile(Csv, *CsvPath);
+		UE_LOG(LogTemp, Display, TEXT("RopeBenchmark results written to %s"), *CsvPath);
+	}
+
+	//return success
+	return 0;
+}
+
+TArray<FRopeBenchmarkScenario> URopeBenchmarkCommandlet::GetScenarios()
+{
+	//storage for the scenarios
+	TArray<FRopeBenchmarkScenario> Scenarios;
+
+	//straight ropes without any geometry to wrap around
+	Scenarios.Add({ TEXT("Straight"), false, 0, false, 2000, 0 });
+	Scenarios.Add({ TEXT("Straight_Long"), false, 0, false, 9000, 0 });
+
+	//ropes wrapping around boxes
+	Scenarios.Add({ TEXT("Wrap_4"), false, 0, false, 6000, 4 });
+	Scenarios.Add({ TEXT("Wrap_16"), false, 0, false, 9000, 16 });
+	Scenarios.Add({ TEXT("Wrap_16_Swept"), false, 0, true, 9000, 16 });
+
+	//verlet ropes
+	Scenarios.Add({ TEXT("Verlet_50"), true, 50, false, 2000, 0 });
+	Scenarios.Add({ TEXT("Verlet_250"), true, 250, false, 6000, 0 });
+	Scenarios.Add({ TEXT("Verlet_250_Wrap_4"), true, 250, false, 6000, 4 });
+	Scenarios.Add({ TEXT("Verlet_250_Swept"), true, 250, true, 6000, 4 });
+
+	//return the scenarios
+	return Scenarios;
+}
+
+FRopeBenchmarkResult URopeBenchmarkCommandlet::RunScenario(const FRopeBenchmarkScenario& Scenario, const int32 NumFrames)
+{
+	//storage for the result
+	FRopeBenchmarkResult Result;
+
+	//create an empty world for the scenario
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, *FString::Printf(TEXT("RopeBenchmark_%s"), *Scenario.Name));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	//get the start and end of the rope
+	const FVector Start = FVector::ZeroVector;
+	const FVector End = FVector(Scenario.RopeLength, 0, 0);
+
+	//get the cube mesh to use for the boxes
+	UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+
+	//storage for the anchor box
+	AStaticMeshActor* Anchor = nullptr;
+
+	//spawn the boxes along the rope (alternating sides so the rope wraps around them as it moves) and the anchor box at the end
+	for (int Index = 0; Index <= Scenario.NumBoxes; ++Index)
+	{
+		//get whether or not this is the anchor
+		const bool bIsAnchor = Index == Scenario.NumBoxes;
+
+		//get the location of the box
+		const float Alpha = float(Index + 1) / float(Scenario.NumBoxes + 1);
+		const FVector Location = bIsAnchor ? End + FVector(100, 0, 0) : FMath::Lerp(Start, End, Alpha) + FVector(0, Index % 2 == 0 ? 150 : -150, 0);
+
+		//spawn the box
+		AStaticMeshActor* Box = World->SpawnActor<AStaticMeshActor>(Location, FRotator::ZeroRotator);
+		Box->GetStaticMeshComponent()->SetStaticMesh(CubeMesh);
+		Box->SetActorScale3D(FVector(2));
+
+		//check if this is the anchor
+		if (bIsAnchor)
+		{
+			Anchor = Box;
+		}
+	}
+
+	//spawn the owner of the rope
+	AActor* Owner = World->SpawnActor<AActor>(Start, FRotator::ZeroRotator);
+	USceneComponent* OwnerRoot = NewObject<USceneComponent>(Owner);
+	Owner->SetRootComponent(OwnerRoot);
+	OwnerRoot->SetMobility(EComponentMobility::Movable);
+	OwnerRoot->RegisterComponent();
+
+	//create the rope (ticked manually so only the rope's own work is timed)
+	URopeComponent* Rope = NewObject<URopeComponent>(Owner);
+	Rope->bUseVerletIntegration = Scenario.bUseVerletIntegration;
+	Rope->NumVerletPoints = FMath::Max(1, Scenario.NumVerletPoints);
+	Rope->bUseSweptCollision = Scenario.bUseSweptCollision;
+	Rope->bFreezeWhenOffScreen = false;
+	Rope->SetupAttachment(OwnerRoot);
+	Rope->RegisterComponent();
+	Rope->SetComponentTickEnabled(false);
+
+	//tick the world once so the boxes are in the physics scene (World->Tick doesn't advance the frame counter, the rope's per-frame caches need it)
+	World->Tick(LEVELTICK_All, 1.f / 60.f);
+	++GFrameCounter;
+
+	//activate the rope on the anchor
+	Rope->ActivateRope(FHitResult(Anchor, Anchor->GetStaticMeshComponent(), End, FVector(-1, 0, 0)));
+
+	//get the allocations and scene queries after activating
+	const int32 StartAllocations = Rope->NumAllocations;
+	const int32 StartQueries = Rope->NumSceneQueries;
+
+	//storage for the total time
+	double TotalSeconds = 0;
+
+	//iterate through all the frames
+	for (int Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		//move the owner in a circle so the rope sweeps across the boxes
+		const float Angle = 2 * PI * Frame / 120.f;
+		Owner->SetActorLocation(Start + FVector(0, FMath::Cos(Angle) * 500, FMath::Sin(Angle) * 500));
+
+		//tick the world (physics and transforms, the rope's tick is disabled) and start a new frame so the rope's per-frame caches expire
+		World->Tick(LEVELTICK_All, 1.f / 60.f);
+		++GFrameCounter;
+
+		//simulate the rope
+		const double FrameStart = FPlatformTime::Seconds();
+		Rope->SimulateRope(1.f / 60.f);
+		const double FrameSeconds = FPlatformTime::Seconds() - FrameStart;
+
+		//add the frame time
+		TotalSeconds += FrameSeconds;
+		Result.MaxFrameMs = FMath::Max(Result.MaxFrameMs, FrameSeconds * 1000.0);
+	}
+
+	//set the result
+	Result.AverageFrameMs = TotalSeconds * 1000.0 / NumFrames;
+	Result.QueriesPerFrame = double(Rope->NumSceneQueries - StartQueries) / NumFrames;
+	Result.Allocations = Rope->NumAllocations - StartAllocations;
+	Result.FinalRopePoints = Rope->RopePoints.Num();
+
+	//deactivate the rope and destroy the world
+	Rope->DeactivateRope();
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	//return the result
+	return Result;
+}
@@ -0,0 +1,43 @@
+#include "Components/GrapplingHook/RopeBenchmarkCommandlet.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FRopeBenchmarkTest, "Hilt.Rope.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FRopeBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	//add a test for every canned scenario
+	for (const FRopeBenchmarkScenario& Scenario : URopeBenchmarkCommandlet::GetScenarios())
+	{
+		OutBeautifiedNames.Add(Scenario.Name);
+		OutTestCommands.Add(Scenario.Name);
+	}
+}
+
+bool FRopeBenchmarkTest::RunTest(const FString& Parameters)
+{
+	//find the scenario of this test
+	const TArray<FRopeBenchmarkScenario> Scenarios = URopeBenchmarkCommandlet::GetScenarios();
+	const FRopeBenchmarkScenario* Scenario = Scenarios.FindByPredicate([&Parameters](const FRopeBenchmarkScenario& Candidate) { return Candidate.Name == Parameters; });
+	if (!TestNotNull(TEXT("Scenario exists"), Scenario))
+	{
+		return false;
+	}
+
+	//run the scenario
+	const FRopeBenchmarkResult Result = URopeBenchmarkCommandlet::RunScenario(*Scenario, 300);
+
+	//report the result
+	AddInfo(FString::Printf(TEXT("avg %.4f ms  max %.4f ms  %.1f queries/frame  %d allocations  %d points"), Result.AverageFrameMs, Result.MaxFrameMs, Result.QueriesPerFrame, Result.Allocations, Result.FinalRopePoints));
+	AddAnalyticsItem(FString::Printf(TEXT("AverageFrameMs=%f"), Result.AverageFrameMs));
+	AddAnalyticsItem(FString::Printf(TEXT("QueriesPerFrame=%f"), Result.QueriesPerFrame));
+
+	//check that the rope is still attached at both ends
+	TestTrue(TEXT("Rope has points"), Result.FinalRopePoints >= 2);
+
+	return true;
+}
+
+#endif
@@ -3,9 +3,41 @@
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraSystem.h"
 //#include "math.h"
+#include "Components/GrapplingHook/RopeForces.h"
 #include "Core/HiltTags.h"
+#include "Kismet/GameplayStatics.h"
 #include "NPC/Components/GrappleableComponent.h"
 #include "Player/PlayerCharacter.h"
+#include "SceneManagement.h"
+
+//stats for the rope's allocations
+DECLARE_STATS_GROUP(TEXT("Rope"), STATGROUP_Rope, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rope Allocations (Frame)"), STAT_RopeAllocationsFrame, STATGROUP_Rope);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Rope Allocations (Last Second)"), STAT_RopeAllocationsPerSecond, STATGROUP_Rope);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rope Scene Queries"), STAT_RopeSceneQueries, STATGROUP_Rope);
+
+//the number of rope allocations in the current second and when the current second started
+static int32 GRopeAllocationsThisSecond = 0;
+static double GRopeAllocationSecondStart = 0;
+
+//function to record rope allocations (and publish the allocations per second stat once a second has passed)
+static void RecordRopeAllocations(const UWorld* World, const int32 NumAllocations)
+{
+	//add the allocations to the frame and second counts
+	INC_DWORD_STAT_BY(STAT_RopeAllocationsFrame, NumAllocations);
+	GRopeAllocationsThisSecond += NumAllocations;
+
+	//check if a second has passed
+	if (World && World->GetRealTimeSeconds() - GRopeAllocationSecondStart >= 1.0)
+	{
+		//publish the allocations of the last second
+		SET_DWORD_STAT(STAT_RopeAllocationsPerSecond, GRopeAllocationsThisSecond);
+
+		//start a new second
+		GRopeAllocationsThisSecond = 0;
+		GRopeAllocationSecondStart = World->GetRealTimeSeconds();
+	}
+}
 
 FVerletConstraint::FVerletConstraint()
 {
@@ -77,12 +109,43 @@ FVector FRopePoint::GetWL() const
 		return Location;
 	}
 
+	//check if the cached world location is still valid
+	if (bIsCacheValid && (!bCachePerFrame || CachedFrame == GFrameCounter))
+	{
+		//return the cached world location
+		return CachedWL;
+	}
+
+	//resolve and cache the world location
+	CachedWL = ResolveWL();
+	CachedFrame = GFrameCounter;
+	bIsCacheValid = true;
+
+	//return the cached world location
+	return CachedWL;
+}
+
+FVector FRopePoint::ResolveWL() const
+{
+	//default to caching until the source's transform changes
+	bCachePerFrame = false;
+
+	//check if we're using world space for this rope point
+	if (bUseWorldSpace)
+	{
+		//return the world location of the component
+		return Location;
+	}
+
 	//check if we have a attached actor
 	if (AttachedActor)
 	{
 		//get the grapplable component of the attached actor
 		if (const UGrappleableComponent* GrappleableComponent = AttachedActor->FindComponentByClass<UGrappleableComponent>())
 		{
+			//set the resolved source
+			ResolvedSource = const_cast<UGrappleableComponent*>(GrappleableComponent);
+
 			//return the location of the grappleable component
 			return GrappleableComponent->GetComponentLocation();
 		}
@@ -91,9 +154,15 @@ FVector FRopePoint::GetWL() const
 	//check if we're using a component for this rope point
 	if (Component->IsValidLowLevelFast())
 	{
+		//set the resolved source
+		ResolvedSource = Component;
+
 		//check if the component has a socket named "GrapplingHookSocket" and that the component is visible
 		if (Component->DoesSocketExist("GrapplingHookSocket") && Component->IsVisible())
 		{
+			//sockets can move (animation) and the component can be hidden without the component's transform changing, so only cache for this frame
+			bCachePerFrame = true;
+
 			//default to the relative location transformed by the attached actor's transform
 			return Component->GetSocketLocation("GrapplingHookSocket");
 		}
@@ -105,14 +174,39 @@ FVector FRopePoint::GetWL() const
 	//check if we're using an actor for this rope point
 	if (AttachedActor)
 	{
+		//set the resolved source
+		ResolvedSource = AttachedActor->GetRootComponent();
+
 		//default to the relative location transformed by the attached actor's transform
 		return AttachedActor->GetTransform().TransformPosition(Location);
 	}
 
+	//nothing to resolve from, so don't keep the cached location
+	bCachePerFrame = true;
+
 	//default to the zero vector to prevent crashes and still have some indication that something went wrong
 	return FVector::ZeroVector;
 }
 
+USceneComponent* FRopePoint::GetTransformSource() const
+{
+	//check if we're using world space for this rope point
+	if (bUseWorldSpace)
+	{
+		return nullptr;
+	}
+
+	//check if the world location hasn't been resolved yet
+	if (!bIsCacheValid)
+	{
+		//resolve the world location (which also resolves the source)
+		GetWL();
+	}
+
+	//return the resolved source
+	return ResolvedSource.Get();
+}
+
 void FRopePoint::SetWL(const FVector& NewLocation)
 {
 	//todo add force so that the rope can pull an attached actor
@@ -170,6 +264,19 @@ void URopeComponent::BeginPlay()
 		//set the player character
 		PlayerCharacter = LocPlayerCharacter;
 	}
+
+	//reserve enough space for a full rope so grappling doesn't allocate (the two end points, the verlet points and the collision points)
+	RopePoints.Reserve(NumVerletPoints + 1 + ReservedCollisionPoints);
+	Constraints.Reserve(NumVerletPoints);
+	CollisionPoints.Reserve(NumVerletPoints + 1);
+	NewAccelerations.SetNumUninitialized(NumVerletPoints + 1 + ReservedCollisionPoints);
+	NiagaraComponents.Reserve(ReservedCollisionPoints);
+	FreeNiagaraComponents.Reserve(ReservedCollisionPoints);
+
+	//set the counted capacities
+	LastRopePointsMax = RopePoints.Max();
+	LastConstraintsMax = Constraints.Max();
+	LastCollisionPointsMax = CollisionPoints.Max();
 }
 
 void URopeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -177,39 +284,101 @@ void URopeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorC
 	//call the parent implementation
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	//simulate and render the rope for this frame
+	SimulateRope(DeltaTime);
+}
+
+void URopeComponent::SimulateRope(const float DeltaTime)
+{
+	//reset the sweep budget for this frame
+	NumSweepsThisFrame = 0;
+
 	//check if we're grappling
 	if (bIsRopeActive)
 	{
-		//update the rope points
-		CheckCollisionPoints();
+		//bind to the transform updates of any new components the rope points are attached to
+		BindTransformSources();
+
+		//store whether the rope was frozen last frame
+		const bool bWasOffScreen = bIsOffScreen;
 
-		//render the rope
-		RenderRope();
+		//update the lod of the rope
+		UpdateLOD();
+
+		//check if the rope just froze or unfroze
+		if (bIsOffScreen != bWasOffScreen)
+		{
+			//iterate through all the niagara components
+			for (UNiagaraComponent* NiagaraComponent : NiagaraComponents)
+			{
+				//hide the niagara component while frozen so it isn't left drawn at its last position
+				if (NiagaraComponent->IsValidLowLevelFast())
+				{
+					NiagaraComponent->SetVisibility(!bIsOffScreen);
+				}
+			}
+		}
 
-		if (bUseVerletIntegration)
+		//check if it's time to check the collision points again (always done, even off-screen, as the collision points decide the direction of the rope)
+		if (++FramesSinceCollisionCheck >= GetCurrentLODSettings().CollisionCheckInterval)
 		{
-			//perform the verlet integration
-			VerletIntegration(DeltaTime);
+			//reset the frame counter
+			FramesSinceCollisionCheck = 0;
+
+			//update the rope points
+			CheckCollisionPoints();
+		}
+
+		//check if the rope isn't frozen because it's off-screen
+		if (!bIsOffScreen)
+		{
+			//render the rope
+			RenderRope();
+
+			if (bUseVerletIntegration)
+			{
+				//perform the verlet integration
+				VerletIntegration(DeltaTime);
+			}
 		}
 	}
+
+	//count any allocations this frame
+	CountArrayAllocations();
 }
 
 void URopeComponent::DestroyComponent(const bool bPromoteChildren)
 {
+	//unbind from the transform updates of the rope points' components
+	UnbindTransformSources();
+
 	//destroy all the niagara components
 	for (UNiagaraComponent* NiagaraComponent : NiagaraComponents)
 	{
 		NiagaraComponent->DestroyComponent();
 	}
 
+	//destroy all the free niagara components
+	for (UNiagaraComponent* NiagaraComponent : FreeNiagaraComponents)
+	{
+		//check if the niagara component is valid
+		if (NiagaraComponent->IsValidLowLevelFast())
+		{
+			NiagaraComponent->DestroyComponent();
+		}
+	}
+
 	//call the parent implementation
 	Super::DestroyComponent(bPromoteChildren);
 }
 
 void URopeComponent::EnforceConstraints()
 {
+	//get the number of constraint iterations to do at the current lod
+	const int32 NumIterations = FMath::Max(1, FMath::RoundToInt(NumConstraintIterations * GetCurrentLODSettings().ConstraintIterationScale));
+
 	//do a number of iterations to enforce the constraints
-	for (int i = 0; i < NumConstraintIterations; i++)
+	for (int i = 0; i < NumIterations; i++)
 	{
 		//iterate through all the constraints
 		for (FVerletConstraint& Constraint : Constraints)
@@ -263,8 +432,8 @@ bool URopeComponent::CheckForCollisions(const FVector& Start, const FVector& End
 	//storage for line trace hit result
 	FHitResult Hit;
 
-	//do a line trace from the old position to the new position
-	GetWorld()->LineTraceSingleByChannel(Hit, Start, End, CollisionChannel, CollisionParams);
+	//do a line trace (or sweep) from the old position to the new position
+	RopeTrace(Hit, Start, End, CollisionParams);
 
 	//check if we hit something
 	if (Hit.IsValidBlockingHit())
@@ -275,8 +444,8 @@ bool URopeComponent::CheckForCollisions(const FVector& Start, const FVector& End
 		//get the penetration depth
 		const float PenetrationDepth = Hit.PenetrationDepth;
 
-		//get the new position of the start point without correcting for the distance that should be traveled
-		const FVector NewPosition = Hit.ImpactPoint + Normal * (PenetrationDepth + 1);
+		//get the new position of the start point without correcting for the distance that should be traveled (the hit location is the impact point for line traces and the sphere's center for sweeps)
+		const FVector NewPosition = Hit.Location + Normal * (PenetrationDepth + 1);
 
 		//move the start point away from the hit (add 1 to the penetration depth to prevent the new position from being inside the hit object)
 		Point.SetWL(NewPosition);
@@ -318,13 +487,8 @@ bool URopeComponent::CheckForCollisions(FRopePoint& Point, const FVector& InNewP
 	//storage for line/sweep trace hit result
 	FHitResult Hit;
 
-	//create a collision shape for the sweep
-	FCollisionShape Shape = FCollisionShape();
-	Shape.SetSphere(RopeRadius);
-
-	//do a line trace from the old position to the new position
-	GetWorld()->LineTraceSingleByChannel(Hit, InNewPosition, OldPosition, CollisionChannel, CollisionParams);
-	//GetWorld()->SweepSingleByChannel(Hit, InNewPosition, OldPosition, FQuat(), CollisionChannel, Shape, CollisionParams);
+	//do a line trace (or sweep) from the old position to the new position
+	RopeTrace(Hit, InNewPosition, OldPosition, CollisionParams);
 
 	//check if we hit something
 	if (Hit.IsValidBlockingHit())
@@ -336,7 +500,7 @@ bool URopeComponent::CheckForCollisions(FRopePoint& Point, const FVector& InNewP
 		const float PenetrationDepth = Hit.PenetrationDepth;
 
 		//get the new position of the start point and move the start point away from the hit (add 1 to the penetration depth to prevent the new position from being inside the hit object)
-		const FVector NewPosition = Hit.ImpactPoint + Normal * (PenetrationDepth + 1);
+		const FVector NewPosition = Hit.Location + Normal * (PenetrationDepth + 1);
 
 		//update the start point
 		Point.SetWL(NewPosition);
@@ -358,12 +522,27 @@ bool URopeComponent::CheckForCollisions(FRopePoint& Point, const FVector& InNewP
 
 void URopeComponent::VerletIntegration(const float DeltaTime)
 {
-	//empty the collision points array
-	CollisionPoints.Empty();
+	//clear the collision points array (keeping its capacity)
+	CollisionPoints.Reset();
+
+	//make sure the acceleration scratch array is big enough for all the rope points
+	if (NewAccelerations.Num() < RopePoints.Num())
+	{
+		NewAccelerations.SetNumUninitialized(RopePoints.Num());
+	}
+
+	//get the force parameters for this frame
+	const FRopeForceParams ForceParams = GetForceParams();
+
+	//calculate the new accelerations of all the rope points in one pass
+	RopeForces::AccumulateAccelerations(RopePoints.GetData(), RopePoints.Num(), ForceParams, NewAccelerations.GetData());
 
 	//iterate through all the rope points
-	for (FRopePoint& RopePoint : RopePoints)
+	for (int Index = 0; Index < RopePoints.Num(); ++Index)
 	{
+		//get the rope point
+		FRopePoint& RopePoint = RopePoints[Index];
+
 		////get the forces acting on the verlet point (gravity, tension, and damping)
 		//FVector Gravity = {0, 0, GetWorld()->GetDefaultGravityZ() * VerletGravityFactor};
 
@@ -393,8 +572,8 @@ void URopeComponent::VerletIntegration(const float DeltaTime)
 		//calculate the new position of the verlet point
 		FVector NewPosition = RopePoint.GetWL() + RopePoint.Velocity * DeltaTime + RopePoint.Acceleration * FMath::Square(DeltaTime) / 2;
 
-		//calculate the new acceleration
-		const FVector NewAcceleration = CalculateAccel(RopePoint);
+		//get the new acceleration from the force accumulation pass
+		const FVector NewAcceleration = NewAccelerations[Index];
 
 		//calculate the new velocity of the verlet point
 		const FVector NewVelocity = RopePoint.Velocity + (RopePoint.Acceleration + NewAcceleration) * DeltaTime / 2;
@@ -423,21 +602,30 @@ void URopeComponent::VerletIntegration(const float DeltaTime)
 
 FVector URopeComponent::CalculateAccel(const FRopePoint& RopePoint) const
 {
-	//get the forces acting on the verlet point
-	const FVector GravityAcceleration= { 0, 0, -9.81 * VerletGravityFactor};
+	//get the force parameters
+	const FRopeForceParams ForceParams = GetForceParams();
+
+	//calculate the acceleration using the scalar reference implementation
+	return RopeForces::CalculateAcceleration(RopePoint.Velocity, ForceParams.WindVelocity, ForceParams);
+}
 
-	//calculate the drag force on the rope point
-	const FVector DragForce = 0.5f * RopeDrag * (RopePoint.Velocity * RopePoint.Velocity);
+FRopeForceParams URopeComponent::GetForceParams() const
+{
+	//storage for the force parameters
+	FRopeForceParams ForceParams;
 
-	//calculate the drag acceleration on the rope point
-	const FVector DragAcceleration = DragForce / RopeMass;
+	//set the gravity acceleration
+	ForceParams.Gravity = { 0, 0, -9.81 * VerletGravityFactor };
 
-	//calculate the acceleration on the rope point
-	const FVector Acceleration = GravityAcceleration - DragAcceleration;
+	//set the wind velocity
+	ForceParams.WindVelocity = WindVelocity;
 
-	//return the acceleration
-	return Acceleration;
+	//set the drag and mass
+	ForceParams.Drag = RopeDrag;
+	ForceParams.Mass = RopeMass;
 
+	//return the force parameters
+	return ForceParams;
 }
 
 void URopeComponent::SetNiagaraSystem(UNiagaraSystem* NewSystem)
@@ -451,6 +639,17 @@ void URopeComponent::SetNiagaraSystem(UNiagaraSystem* NewSystem)
 		//set the new niagara system
 		NiagaraComponent->SetAsset(NiagaraSystem);
 	}
+
+	//iterate through all the free niagara components
+	for (UNiagaraComponent* NiagaraComponent : FreeNiagaraComponents)
+	{
+		//check if the niagara component is valid
+		if (NiagaraComponent->IsValidLowLevelFast())
+		{
+			//set the new niagara system
+			NiagaraComponent->SetAsset(NiagaraSystem);
+		}
+	}
 }
 
 FCollisionQueryParams URopeComponent::GetCollisionParams() const
@@ -475,6 +674,35 @@ FCollisionQueryParams URopeComponent::GetCollisionParams() const
 	return CollisionParams;
 }
 
+bool URopeComponent::RopeTrace(FHitResult& OutHit, const FVector& Start, const FVector& End, const FCollisionQueryParams& CollisionParams) const
+{
+	//count the scene query
+	NumSceneQueries++;
+	INC_DWORD_STAT(STAT_RopeSceneQueries);
+
+	//check if we should use sphere sweeps and that we're within the sweep budget for this frame
+	if (bUseSweptCollision && RopeRadius > 0 && (MaxSweepsPerFrame <= 0 || NumSweepsThisFrame < MaxSweepsPerFrame))
+	{
+		//get the direction and length of the segment
+		FVector Direction;
+		float Length;
+		(End - Start).ToDirectionAndLength(Direction, Length);
+
+		//check if the segment is long enough to be swept (rope points are usually on or a radius away from a surface, so we trim a radius off both ends to avoid the sweep always starting or ending inside of it)
+		if (Length > RopeRadius * 2)
+		{
+			//increment the sweep count
+			NumSweepsThisFrame++;
+
+			//do the sphere sweep
+			return GetWorld()->SweepSingleByChannel(OutHit, Start + Direction * RopeRadius, End - Direction * RopeRadius, FQuat::Identity, CollisionChannel, FCollisionShape::MakeSphere(RopeRadius), CollisionParams);
+		}
+	}
+
+	//default to a line trace (either the thick rope mode is disabled or we're over the sweep budget for this frame)
+	return GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, CollisionChannel, CollisionParams);
+}
+
 void URopeComponent::CheckCollisionPoints()
 {
 	//get the collision parameters
@@ -488,8 +716,7 @@ void URopeComponent::CheckCollisionPoints()
 		{
 			//sweep from the previous rope point to the next rope point
 			FHitResult Surrounding;
-			//GetWorld()->SweepSingleByChannel(Surrounding, RopePoints[Index - 1].GetWL(), RopePoints[Index + 1].GetWL(), FQuat(), ECC_Visibility, FCollisionShape::MakeSphere(RopeRadius), CollisionParams);
-			GetWorld()->LineTraceSingleByChannel(Surrounding, RopePoints[Index - 1].GetWL(), RopePoints[Index + 1].GetWL(), CollisionChannel, CollisionParams);
+			RopeTrace(Surrounding, RopePoints[Index - 1].GetWL(), RopePoints[Index + 1].GetWL(), CollisionParams);
 			//DrawDebugLine(GetWorld(), RopePoints[Index - 1].GetWL(), RopePoints[Index + 1].GetWL(), FColor::Blue, false, 0.f, 0, 5.f);
 
 			//check if the sweep didn't return a blocking hit and didn't started inside an object
@@ -498,15 +725,7 @@ void URopeComponent::CheckCollisionPoints()
 				//remove the rope point from the array
 				RopePoints.RemoveAt(Index);
 
-				//check if we need to remove the niagara component for this rope point
-				if (NiagaraComponents.IsValidIndex(Index) && NiagaraComponents[Index]->IsValidLowLevelFast())
-				{
-					//destroy the niagara component
-					NiagaraComponents[Index]->DestroyComponent();
-					
-					//remove the niagara component from the array
-					NiagaraComponents.RemoveAt(Index);
-				}
+				//the niagara components are per rendered segment, so RenderRope releases any it no longer needs
 
 				//decrement i so we don't skip the next rope point
 				Index--;
@@ -523,8 +742,7 @@ void URopeComponent::CheckCollisionPoints()
 			FHitResult Next;
 
 			//sweep from the current rope point to the next rope point
-			//GetWorld()->SweepSingleByChannel(Next, RopePoints[Index].GetWL(), RopePoints[Index + 1].GetWL(), FQuat(), CollisionChannel, FCollisionShape::MakeSphere(RopeRadius), CollisionParams);
-			GetWorld()->LineTraceSingleByChannel(Next, RopePoints[Index].GetWL(), RopePoints[Index + 1].GetWL(), CollisionChannel, CollisionParams);
+			RopeTrace(Next, RopePoints[Index].GetWL(), RopePoints[Index + 1].GetWL(), CollisionParams);
 
 
 			//check for hits
@@ -547,8 +765,12 @@ void URopeComponent::CheckCollisionPoints()
 						}
 					}
 
+					//create the new rope point at the hit location (the sphere's center when sweeping so thick ropes wrap around the geometry instead of clipping into it)
+					FRopePoint NewRopePoint(Next.GetActor(), Next.Location);
+					NewRopePoint.bIsCollisionPoint = true;
+
 					//insert the new rope point at the correct tarray index
-					RopePoints.Insert(FRopePoint(Next), Index + 1);
+					RopePoints.Insert(NewRopePoint, Index + 1);
 				}
 
 				//DrawDebugLine(GetWorld(), RopePoints[Index].GetWL(), RopePoints[Index + 1].GetWL(), FColor::Yellow, false, 0.f, 0, 5.f);
@@ -557,20 +779,63 @@ void URopeComponent::CheckCollisionPoints()
 	}
 }
 
-void URopeComponent::SpawnNiagaraSystem(int Index)
+void URopeComponent::SpawnNiagaraSystem(int Index, int EndIndex)
 {
-	//create a new Niagara component
-	UNiagaraComponent* NewNiagaraComponent = UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), NiagaraSystem, RopePoints[Index].GetWL());
+	//check if we should use the next point as the end of the Niagara component
+	if (EndIndex == INDEX_NONE)
+	{
+		EndIndex = Index + 1;
+	}
 
-	//set the end location of the Niagara component
-	NewNiagaraComponent->SetVectorParameter(RibbonEndParameterName, RopePoints[Index + 1].GetWL());
+	//storage for the Niagara component to use
+	UNiagaraComponent* NewNiagaraComponent = nullptr;
+
+	//try to reuse a free Niagara component
+	while (!NewNiagaraComponent && !FreeNiagaraComponents.IsEmpty())
+	{
+		//get the last free Niagara component
+		UNiagaraComponent* FreeNiagaraComponent = FreeNiagaraComponents.Pop(EAllowShrinking::No);
 
-	//set tick group and behavior
-	NewNiagaraComponent->SetTickGroup(TG_LastDemotable);
-	NewNiagaraComponent->SetTickBehavior(ENiagaraTickBehavior::UseComponentTickGroup);
+		//check if the free Niagara component is still valid
+		if (FreeNiagaraComponent->IsValidLowLevelFast())
+		{
+			//use the free Niagara component
+			NewNiagaraComponent = FreeNiagaraComponent;
+
+			//move the Niagara component to the rope point and reactivate it
+			NewNiagaraComponent->SetWorldLocation(RopePoints[Index].GetWL());
+			NewNiagaraComponent->SetVisibility(true);
+			NewNiagaraComponent->Activate(true);
+		}
+	}
+
+	//check if we couldn't reuse a Niagara component
+	if (!NewNiagaraComponent)
+	{
+		//create a new Niagara component (not auto destroyed so it can be reused after the rope is deactivated)
+		NewNiagaraComponent = UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), NiagaraSystem, RopePoints[Index].GetWL(), FRotator::ZeroRotator, FVector::OneVector, false);
+
+		//check if the Niagara component wasn't created
+		if (!NewNiagaraComponent)
+		{
+			//return to prevent further execution
+			return;
+		}
 
-	//add the no grapple tag to the Niagara component
-	NewNiagaraComponent->ComponentTags.Add(HiltTags::NoGrappleTag);
+		//record the allocation
+		NumAllocations++;
+		RecordRopeAllocations(GetWorld(), 1);
+
+		//set tick group and behavior
+		NewNiagaraComponent->SetTickGroup(TG_LastDemotable);
+		NewNiagaraComponent->SetTickBehavior(ENiagaraTickBehavior::UseComponentTickGroup);
+
+		//add the no grapple tag to the Niagara component
+		NewNiagaraComponent->ComponentTags.Add(HiltTags::NoGrappleTag);
+	}
+
+	//set the end location of the Niagara component
+	NewNiagaraComponent->SetVectorParameter(RibbonEndParameterName, RopePoints[EndIndex].GetWL());
 
 	//add the new Niagara component to the array
 	NiagaraComponents.Add(NewNiagaraComponent);
@@ -608,23 +873,46 @@ void URopeComponent::RenderRope()
 		return;
 	}
 
+	//get how many rope points each rendered segment should span at the current lod
+	const int32 RenderStride = FMath::Max(1, GetCurrentLODSettings().RenderStride);
+
+	//the index of the segment we're rendering
+	int SegmentIndex = 0;
+
 	//iterate through all the rope points except the last one
-	for (int Index = 0; Index < RopePoints.Num() - 1; ++Index)
+	for (int Index = 0; Index < RopePoints.Num() - 1; ++SegmentIndex)
 	{
+		//get the index of the point at the end of this segment (never skipping collision points so the rope still wraps around geometry)
+		int EndIndex = Index + 1;
+		while (EndIndex < RopePoints.Num() - 1 && EndIndex - Index < RenderStride && !RopePoints[EndIndex].bIsCollisionPoint)
+		{
+			EndIndex++;
+		}
+
 		//check if we have a valid Niagara component to use or if we need to create a new one
-		if (NiagaraComponents.IsValidIndex(Index) && NiagaraComponents[Index]->IsValidLowLevelFast())
+		if (NiagaraComponents.IsValidIndex(SegmentIndex) && NiagaraComponents[SegmentIndex]->IsValidLowLevelFast())
 		{
 			//set the start location of the Niagara component
-			NiagaraComponents[Index]->SetWorldLocation(RopePoints[Index].GetWL());
+			NiagaraComponents[SegmentIndex]->SetWorldLocation(RopePoints[Index].GetWL());
 
 			//set the end location of the Niagara component
-			NiagaraComponents[Index]->SetVectorParameter(RibbonEndParameterName, RopePoints[Index + 1].GetWL());
+			NiagaraComponents[SegmentIndex]->SetVectorParameter(RibbonEndParameterName, RopePoints[EndIndex].GetWL());
 		}
 		else
 		{
 			//create a new Niagara component
-			SpawnNiagaraSystem(Index);
+			SpawnNiagaraSystem(Index, EndIndex);
 		}
+
+		//move on to the start of the next segment
+		Index = EndIndex;
+	}
+
+	//release any Niagara components we no longer need (when the render stride increased)
+	while (NiagaraComponents.Num() > SegmentIndex)
+	{
+		//release the niagara component so it can be reused
+		ReleaseNiagaraComponent(NiagaraComponents.Pop(EAllowShrinking::No));
 	}
 }
 
@@ -633,25 +921,118 @@ void URopeComponent::DeactivateRope()
 	//set the active state to false
 	bIsRopeActive = false;
 
+	//unbind from the transform updates of the rope points' components
+	UnbindTransformSources();
+
 	//iterate through all the niagara components
 	for (UNiagaraComponent* NiagaraComponent : NiagaraComponents)
 	{
-		//destroy the niagara component
-		NiagaraComponent->DestroyComponent();
+		//release the niagara component so it can be reused by the next grapple
+		ReleaseNiagaraComponent(NiagaraComponent);
 	}
 
-	//clear the niagara components array
-	NiagaraComponents.Empty();
+	//clear the niagara components array (keeping its capacity)
+	NiagaraComponents.Reset();
+
+	//clear the rope points array (keeping its capacity)
+	RopePoints.Reset();
 
-	//clear the rope points array
-	RopePoints.Empty();
+	//clear the collision points array (keeping its capacity)
+	CollisionPoints.Reset();
 
 	//check if we're using verlet integration
 	if (bUseVerletIntegration)
 	{
-		//clear the constraints array
-		Constraints.Empty();
+		//clear the constraints array (keeping its capacity)
+		Constraints.Reset();
+	}
+}
+
+void URopeComponent::BindTransformSources()
+{
+	//iterate through all the rope points
+	for (const FRopePoint& RopePoint : RopePoints)
+	{
+		//get the component the rope point is attached to (if any)
+		USceneComponent* Source = RopePoint.GetTransformSource();
+
+		//check if the rope point isn't attached to anything or we're already bound to the component
+		if (!Source || BoundTransformSources.Contains(Source))
+		{
+			continue;
+		}
+
+		//bind to the transform updates of the component
+		BoundTransformSources.Add(Source, Source->TransformUpdated.AddUObject(this, &URopeComponent::OnTransformSourceUpdated));
+	}
+}
+
+void URopeComponent::UnbindTransformSources()
+{
+	//iterate through all the bound components
+	for (const TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle>& BoundSource : BoundTransformSources)
+	{
+		//check if the component still exists
+		if (USceneComponent* Source = BoundSource.Key.Get())
+		{
+			//unbind from the transform updates of the component
+			Source->TransformUpdated.Remove(BoundSource.Value);
+		}
+	}
+
+	//clear the bound components
+	BoundTransformSources.Reset();
+}
+
+void URopeComponent::OnTransformSourceUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	//iterate through all the rope points
+	for (const FRopePoint& RopePoint : RopePoints)
+	{
+		//check if the rope point is attached to the updated component
+		if (!RopePoint.bUseWorldSpace && RopePoint.ResolvedSource == UpdatedComponent)
+		{
+			//invalidate the cached world location
+			RopePoint.InvalidateCache();
+		}
+	}
+}
+
+void URopeComponent::ReleaseNiagaraComponent(UNiagaraComponent* NiagaraComponent)
+{
+	//check if the niagara component is valid
+	if (!NiagaraComponent->IsValidLowLevelFast())
+	{
+		return;
+	}
+
+	//deactivate and hide the niagara component
+	NiagaraComponent->DeactivateImmediate();
+	NiagaraComponent->SetVisibility(false);
+
+	//add the niagara component to the free list
+	FreeNiagaraComponents.Add(NiagaraComponent);
+}
+
+void URopeComponent::CountArrayAllocations()
+{
+	//get the number of arrays whose capacity changed
+	const int32 NumArrayAllocations = (RopePoints.Max() != LastRopePointsMax) + (Constraints.Max() != LastConstraintsMax) + (CollisionPoints.Max() != LastCollisionPointsMax);
+
+	//check if there were any allocations
+	if (NumArrayAllocations > 0)
+	{
+		//set the counted capacities
+		LastRopePointsMax = RopePoints.Max();
+		LastConstraintsMax = Constraints.Max();
+		LastCollisionPointsMax = CollisionPoints.Max();
 	}
+
+	//add the allocations to the total
+	NumAllocations += NumArrayAllocations;
+
+	//record the allocations (also publishes the per second stat when no allocations happened)
+	RecordRopeAllocations(GetWorld(), NumArrayAllocations);
 }
 
 // ReSharper disable once CppParameterMayBeConstPtrOrRef (non-const reference is required for the OtherActor parameter)
@@ -663,9 +1044,34 @@ void URopeComponent::ActivateRope(const FHitResult& HitResult)
 	//set the active state to true
 	bIsRopeActive = true;
 
-	//set the rope points
-	RopePoints = { FRopePoint(GetOwner(), GetComponentLocation()), FRopePoint(HitResult) };
-	RopePoints[0].Component = PlayerCharacter->RopeMesh;
+	//set the rope points (reset and added to so the reserved capacity is kept)
+	RopePoints.Reset();
+	RopePoints.Add(FRopePoint(GetOwner(), GetComponentLocation()));
+	RopePoints.Add(FRopePoint(HitResult));
+
+	//check if we have a player character to attach the start of the rope to (ropes without one stay attached to the owner)
+	if (PlayerCharacter)
+	{
+		//attach the start of the rope to the rope mesh
+		RopePoints[0].Component = PlayerCharacter->RopeMesh;
+		RopePoints[0].InvalidateCache();
+	}
+
+	//bind to the transform updates of the components the end points are attached to
+	BindTransformSources();
+
+	//clear the constraints and collision points (keeping their capacity)
+	Constraints.Reset();
+	CollisionPoints.Reset();
+
+	//reset the collision check frame counter
+	FramesSinceCollisionCheck = 0;
+
+	//update the lod of the rope so the number of verlet points matches the distance to the camera
+	UpdateLOD();
+
+	//get the number of verlet points to use at the current lod
+	const int32 NumLODVerletPoints = FMath::Max(1, FMath::RoundToInt(NumVerletPoints * GetCurrentLODSettings().VerletPointScale));
 
 	//get the direction from the first rope point to the second rope point
 	const FVector Direction = RopePoints[1].GetWL() - RopePoints[0].GetWL();
@@ -674,10 +1080,10 @@ void URopeComponent::ActivateRope(const FHitResult& HitResult)
 	if (bUseVerletIntegration)
 	{
 		//add the extra verlet points
-		for (int Index = 0; Index < NumVerletPoints - 1; ++Index)
+		for (int Index = 0; Index < NumLODVerletPoints - 1; ++Index)
 		{
 			//get how far along the rope the verlet point should be
-			const float Alpha = float(Index + 1) / float(NumVerletPoints + 1);
+			const float Alpha = float(Index + 1) / float(NumLODVerletPoints + 1);
 
 			//the position of the rope point interpolated between the two rope points
 			const FVector Position = RopePoints[0].GetWL() + Direction * Alpha;
@@ -690,19 +1096,19 @@ void URopeComponent::ActivateRope(const FHitResult& HitResult)
 		}
 
 		//get the distance between of the constraint
-		const float Dist = Direction.Size() / (NumVerletPoints + 1) * (1 - Stiffness);
+		const float Dist = Direction.Size() / (NumLODVerletPoints + 1) * (1 - Stiffness);
 
 		//add the constraints
 		for (int Index = 0; Index < RopePoints.Num() - 1; ++Index)
 		{
 			//get how far along the rope the the constraint is
-			const float Alpha = float(Index + 1) / float(NumVerletPoints + 1);
+			const float Alpha = float(Index + 1) / float(NumLODVerletPoints + 1);
 
-			//get the value of constraint compensation 1 curve
-			const float Compensation1 = ConstraintCompensation1Curve->GetFloatValue(Alpha);
+			//get the value of constraint compensation 1 curve (defaulting to an even split)
+			const float Compensation1 = ConstraintCompensation1Curve ? ConstraintCompensation1Curve->GetFloatValue(Alpha) : 0.5f;
 
-			//get the value of constraint compensation 2 curve
-			const float Compensation2 = ConstraintCompensation2Curve->GetFloatValue(Alpha);
+			//get the value of constraint compensation 2 curve (defaulting to an even split)
+			const float Compensation2 = ConstraintCompensation2Curve ? ConstraintCompensation2Curve->GetFloatValue(Alpha) : 0.5f;
 
 			//add the constraint to the rope
 			Constraints.Add(FVerletConstraint(&RopePoints[Index], &RopePoints[Index + 1], Compensation1, Compensation2, Dist));
@@ -712,10 +1118,76 @@ void URopeComponent::ActivateRope(const FHitResult& HitResult)
 		}
 	}
 
+	//count any allocations from activating the rope
+	CountArrayAllocations();
+
 	////set the old locations of the rope points
 	//SetRopeOldLocations(GetWorld()->GetDeltaSeconds());
 }
 
+void URopeComponent::UpdateLOD()
+{
+	//default to full detail and on-screen
+	CurrentLODIndex = INDEX_NONE;
+	bIsOffScreen = false;
+
+	//check if we have no lods and don't need to check if we're off-screen
+	if (LODSettings.IsEmpty() && !bFreezeWhenOffScreen)
+	{
+		//return to prevent further execution
+		return;
+	}
+
+	//get the player controller and check if it has a camera manager
+	const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	if (!PlayerController || !PlayerController->PlayerCameraManager)
+	{
+		//return to prevent further execution
+		return;
+	}
+
+	//get the view of the camera
+	const FMinimalViewInfo& View = PlayerController->PlayerCameraManager->GetCameraCacheView();
+
+	//get the projection matrices of the camera
+	FMatrix ViewMatrix, ProjectionMatrix, ViewProjectionMatrix;
+	UGameplayStatics::GetViewProjectionMatrix(View, ViewMatrix, ProjectionMatrix, ViewProjectionMatrix);
+
+	//get the bounds of the rope
+	const FBox Bounds = GetRopeBounds();
+
+	//check if we should check if the rope is off-screen
+	if (bFreezeWhenOffScreen)
+	{
+		//get the view frustum of the camera
+		FConvexVolume Frustum;
+		GetViewFrustumBounds(Frustum, ViewProjectionMatrix, false);
+
+		//set whether or not the rope is off-screen
+		bIsOffScreen = !Frustum.IntersectBox(Bounds.GetCenter(), Bounds.GetExtent());
+	}
+
+	//get the distance from the camera to the rope (0 when the camera is inside the rope's bounds)
+	const float Distance = FMath::Sqrt(Bounds.ComputeSquaredDistanceToPoint(View.Location));
+
+	//get the screen size of the rope
+	const float ScreenSize = ComputeBoundsScreenSize(FVector4(Bounds.GetCenter()), Bounds.GetExtent().Size(), FVector4(View.Location), ProjectionMatrix);
+
+	//iterate through the lods from least to most detailed
+	for (int Index = LODSettings.Num() - 1; Index >= 0; --Index)
+	{
+		//check if the rope is far enough away or small enough on screen to use this lod
+		if ((LODSettings[Index].MinDistance > 0 && Distance >= LODSettings[Index].MinDistance) || ScreenSize < LODSettings[Index].MaxScreenSize)
+		{
+			//set the current lod
+			CurrentLODIndex = Index;
+
+			//return to prevent further execution
+			return;
+		}
+	}
+}
+
 FVector URopeComponent::GetRopeDirection() const
 {
 	//get the direction from the first rope point to the second rope point
@@ -755,3 +1227,32 @@ FVector URopeComponent::GetSecondRopePoint() const
 {
 	return RopePoints[1].GetWL();
 }
+
+FRopeLODSettings URopeComponent::GetCurrentLODSettings() const
+{
+	//check if we're using one of the lods
+	if (LODSettings.IsValidIndex(CurrentLODIndex))
+	{
+		//return the settings of the current lod
+		return LODSettings[CurrentLODIndex];
+	}
+
+	//default to full detail
+	return FRopeLODSettings();
+}
+
+FBox URopeComponent::GetRopeBounds() const
+{
+	//storage for the bounds
+	FBox Bounds(ForceInit);
+
+	//iterate through all the rope points
+	for (const FRopePoint& RopePoint : RopePoints)
+	{
+		//add the rope point to the bounds
+		Bounds += RopePoint.GetWL();
+	}
+
+	//expand the bounds by the rope radius
+	return Bounds.ExpandBy(RopeRadius);
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include "Components/GrapplingHook/RopeForces.h"
+
+#include "Components/GrapplingHook/RopeComponent.h"
+
+void RopeForces::AccumulateAccelerations(const FRopePoint* Points, const int32 NumPoints, const FRopeForceParams& Params, FVector* OutAccelerations, const FVector* WindField)
+{
+	//load the constant parts of the force calculation into registers once for the whole pass
+	const VectorRegister GravityReg = VectorLoadFloat3_W0(&Params.Gravity.X);
+	const VectorRegister UniformWindReg = VectorLoadFloat3_W0(&Params.WindVelocity.X);
+	const VectorRegister DragFactorReg = VectorSetFloat1(static_cast<FVector::FReal>(0.5f * Params.Drag / Params.Mass));
+
+	//iterate through all the rope points
+	for (int32 Index = 0; Index < NumPoints; ++Index)
+	{
+		//get the wind velocity at this rope point
+		const VectorRegister WindReg = WindField ? VectorLoadFloat3_W0(&WindField[Index].X) : UniformWindReg;
+
+		//get the velocity of the rope point relative to the air
+		const VectorRegister RelativeVelocityReg = VectorSubtract(VectorLoadFloat3_W0(&Points[Index].Velocity.X), WindReg);
+
+		//get the speed of the rope point relative to the air
+		const VectorRegister SpeedReg = VectorSqrt(VectorDot3(RelativeVelocityReg, RelativeVelocityReg));
+
+		//calculate the drag acceleration (|v| * v keeps the sign of every component, unlike v * v)
+		const VectorRegister DragReg = VectorMultiply(VectorMultiply(SpeedReg, RelativeVelocityReg), DragFactorReg);
+
+		//store the acceleration on the rope point
+		VectorStoreFloat3(VectorSubtract(GravityReg, DragReg), &OutAccelerations[Index].X);
+	}
+}
+
+FVector RopeForces::CalculateAcceleration(const FVector& Velocity, const FVector& WindVelocity, const FRopeForceParams& Params)
+{
+	//get the velocity of the rope point relative to the air
+	const FVector RelativeVelocity = Velocity - WindVelocity;
+
+	//calculate the drag force on the rope point (signed, opposing the relative velocity)
+	const FVector DragForce = 0.5f * Params.Drag * RelativeVelocity.Size() * RelativeVelocity;
+
+	//calculate the acceleration on the rope point
+	return Params.Gravity - DragForce / Params.Mass;
+}
+
+void RopeForces::AccumulateAccelerationsScalar(const FRopePoint* Points, const int32 NumPoints, const FRopeForceParams& Params, FVector* OutAccelerations, const FVector* WindField)
+{
+	//iterate through all the rope points
+	for (int32 Index = 0; Index < NumPoints; ++Index)
+	{
+		//calculate the acceleration of the rope point
+		OutAccelerations[Index] = CalculateAcceleration(Points[Index].Velocity, WindField ? WindField[Index] : Params.WindVelocity, Params);
+	}
+}
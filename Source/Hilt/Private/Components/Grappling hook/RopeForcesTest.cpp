@@ -0,0 +1,73 @@
+#include "Components/GrapplingHook/RopeForces.h"
+
+#include "Components/GrapplingHook/RopeComponent.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRopeForcesMatchScalarTest, "Hilt.Rope.Forces.MatchesScalarReference", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRopeForcesMatchScalarTest::RunTest(const FString& Parameters)
+{
+	//make fixed rope points (at rest, against the wind, with the wind, diagonal and fast)
+	TArray<FRopePoint> Points;
+	Points.SetNum(6);
+	Points[0].Velocity = FVector::ZeroVector;
+	Points[1].Velocity = FVector(-350, 0, 0);
+	Points[2].Velocity = FVector(200, 0, 0);
+	Points[3].Velocity = FVector(120, -80, 45);
+	Points[4].Velocity = FVector(-1500, 2200, -3100);
+	Points[5].Velocity = FVector(0, 0, -980);
+
+	//make a per point wind field
+	TArray<FVector> WindField;
+	WindField.SetNum(Points.Num());
+	for (int32 Index = 0; Index < WindField.Num(); ++Index)
+	{
+		WindField[Index] = FVector(100 * Index, -50, 25 * (Index % 3));
+	}
+
+	//make the force parameters (gravity only, drag only and both with a non-unit mass and wind)
+	TArray<FRopeForceParams> ParamSets;
+	ParamSets.AddDefaulted(3);
+	ParamSets[0].Gravity = FVector(0, 0, -980);
+	ParamSets[1].Drag = 0.01f;
+	ParamSets[2].Gravity = FVector(0, 0, -1960);
+	ParamSets[2].WindVelocity = FVector(300, 150, 0);
+	ParamSets[2].Drag = 0.004f;
+	ParamSets[2].Mass = 2.5f;
+
+	//the accelerations of both implementations
+	TArray<FVector> Vectorized;
+	TArray<FVector> Scalar;
+	Vectorized.SetNum(Points.Num());
+	Scalar.SetNum(Points.Num());
+
+	//iterate through the force parameters
+	for (int32 ParamIndex = 0; ParamIndex < ParamSets.Num(); ++ParamIndex)
+	{
+		//check with the uniform wind and with the wind field
+		for (const FVector* Wind : { static_cast<const FVector*>(nullptr), WindField.GetData() })
+		{
+			//calculate the accelerations with both implementations
+			RopeForces::AccumulateAccelerations(Points.GetData(), Points.Num(), ParamSets[ParamIndex], Vectorized.GetData(), Wind);
+			RopeForces::AccumulateAccelerationsScalar(Points.GetData(), Points.Num(), ParamSets[ParamIndex], Scalar.GetData(), Wind);
+
+			//compare every rope point (relative to the size of the acceleration)
+			for (int32 Index = 0; Index < Points.Num(); ++Index)
+			{
+				const double Tolerance = KINDA_SMALL_NUMBER * FMath::Max(1.0, Scalar[Index].GetAbsMax());
+				TestTrue(FString::Printf(TEXT("Params %d, point %d, %s wind: %s matches %s"), ParamIndex, Index, Wind ? TEXT("field") : TEXT("uniform"), *Vectorized[Index].ToString(), *Scalar[Index].ToString()), Vectorized[Index].Equals(Scalar[Index], Tolerance));
+			}
+		}
+	}
+
+	//check that drag opposes the relative velocity on every axis (the sign bug this pass replaced)
+	RopeForces::AccumulateAccelerations(Points.GetData(), Points.Num(), ParamSets[1], Vectorized.GetData());
+	TestTrue(TEXT("Drag opposes a negative velocity"), Vectorized[1].X > 0);
+	TestTrue(TEXT("Drag opposes a positive velocity"), Vectorized[2].X < 0);
+
+	return true;
+}
+
+#endif
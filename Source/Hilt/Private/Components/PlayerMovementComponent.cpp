@@ -97,7 +97,7 @@ void UPlayerMovementComponent::StartSlide()
 		SlideStartTime = GetWorld()->GetTimeSeconds();
 
 		//bind the slide score banking timer
-		GetWorld()->GetTimerManager().SetTimer(SlideScoreBankTimer, this, &UPlayerMovementComponent::BankSlideScore, SlideScoreBankRate, true);
+		SlideScoreBankTimer = GetWorld()->GetSubsystem<UGameplaySchedulerSubsystem>()->SetTimer(this, &UPlayerMovementComponent::BankSlideScore, SlideScoreBankRate, true);
 	}
 
 	//set the sliding variable
@@ -132,7 +132,37 @@ void UPlayerMovementComponent::StopSlide()
 	OnPlayerStopSlide.Broadcast();
 
 	//unbind the slide score banking timer
-	GetWorld()->GetTimerManager().ClearTimer(SlideScoreBankTimer);
+	GetWorld()->GetSubsystem<UGameplaySchedulerSubsystem>()->ClearTimer(SlideScoreBankTimer);
+}
+
+void UPlayerMovementComponent::ResetTransientState()
+{
+	//get the scheduler
+	UGameplaySchedulerSubsystem* Scheduler = GetWorld()->GetSubsystem<UGameplaySchedulerSubsystem>();
+
+	//cancel the slide timers
+	Scheduler->ClearTimer(SlideScoreBankTimer);
+	Scheduler->ClearTimer(SlideJumpGravityResetTimer);
+
+	//check if we're sliding
+	if (bIsSliding)
+	{
+		//call the blueprint event so anything started by the slide stops with it
+		OnPlayerStopSlide.Broadcast();
+	}
+
+	//stop sliding without banking the pending slide score
+	PendingSlideScore = 0;
+	bIsSliding = false;
+	SlideSpeedGained = 0;
+
+	//check if we're slide jumping
+	if (bIsSlideJumping)
+	{
+		//stop slide jumping and reset the gravity
+		bIsSlideJumping = false;
+		GravityScale = DefaultGravityScale;
+	}
 }
 
 bool UPlayerMovementComponent::IsSliding() const
@@ -162,6 +192,10 @@ void UPlayerMovementComponent::BeginPlay()
 
 	//set the default gravity scale
 	DefaultGravityScale = GravityScale;
+
+	//set the default simulation time step and iterations
+	DefaultMaxSimulationTimeStep = MaxSimulationTimeStep;
+	DefaultMaxSimulationIterations = MaxSimulationIterations;
 }
 
 void UPlayerMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -408,8 +442,63 @@ void UPlayerMovementComponent::PerformMovement(float DeltaTime)
 		Velocity = DeltaRotation.RotateVector(Velocity);
 	}
 
+	//raise the substep count if we're moving fast enough to tunnel
+	const bool bChangedSubstepping = ApplyAdaptiveSubstepping(DeltaTime);
+
 	//call the parent implementation
 	Super::PerformMovement(DeltaTime);
+
+	//check if we changed the substepping
+	if (bChangedSubstepping)
+	{
+		//restore the default simulation time step and iterations
+		MaxSimulationTimeStep = DefaultMaxSimulationTimeStep;
+		MaxSimulationIterations = DefaultMaxSimulationIterations;
+	}
+}
+
+bool UPlayerMovementComponent::ApplyAdaptiveSubstepping(const float DeltaTime)
+{
+	//default to the normal number of iterations
+	CurrentSimulationIterations = DefaultMaxSimulationIterations;
+
+	//check if we shouldn't use adaptive substepping, don't have a character to get the capsule from or aren't moving fast enough
+	if (!bUseAdaptiveSubstepping || !CharacterOwner || DeltaTime <= 0 || Velocity.SizeSquared() < FMath::Square(MinAdaptiveSubstepSpeed))
+	{
+		return false;
+	}
+
+	//get how far the player is allowed to move per substep
+	const float AllowedDisplacement = CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius() * AdaptiveSubstepRadiusFraction;
+
+	//get how far the player will move this frame
+	const float Displacement = Velocity.Size() * DeltaTime;
+
+	//get how many substeps the default settings would use (substeps are at most the max time step long)
+	const int32 DefaultSubsteps = FMath::Min(FMath::CeilToInt(DeltaTime / DefaultMaxSimulationTimeStep), DefaultMaxSimulationIterations);
+
+	//check if the player won't move further than allowed per substep with the default settings
+	if (AllowedDisplacement <= 0 || Displacement / FMath::Max(DefaultSubsteps, 1) <= AllowedDisplacement)
+	{
+		return false;
+	}
+
+	//get the number of substeps needed to stay under the allowed displacement (capped)
+	const int32 NeededSubsteps = FMath::Clamp(FMath::CeilToInt(Displacement / AllowedDisplacement), DefaultSubsteps, MaxAdaptiveSimulationIterations);
+
+	//check if the cap doesn't allow any more substeps than the default
+	if (NeededSubsteps <= DefaultSubsteps)
+	{
+		return false;
+	}
+
+	//shorten the substeps and allow enough iterations for them
+	MaxSimulationTimeStep = DeltaTime / NeededSubsteps;
+	MaxSimulationIterations = FMath::Max(DefaultMaxSimulationIterations, NeededSubsteps);
+	CurrentSimulationIterations = MaxSimulationIterations;
+
+	//return that the settings were changed
+	return true;
 }
 
 void UPlayerMovementComponent::HandleWalkingOffLedge(const FVector& PreviousFloorImpactNormal, const FVector& PreviousFloorContactNormal, const FVector& PreviousLocation, float TimeDelta)
@@ -991,15 +1080,12 @@ bool UPlayerMovementComponent::DoJump(bool bReplayingMoves)
 		//set the gravity scale to 0
 		GravityScale = 0;
 
-		//throwaway timer handle
-		FTimerHandle SlideJumpGravityResetTimer;
-
-		//use timer manager lamba to reset the slide jump variable
-		GetWorld()->GetTimerManager().SetTimer(SlideJumpGravityResetTimer, [this]
+		//use a scheduler lambda to reset the slide jump variable
+		SlideJumpGravityResetTimer = GetWorld()->GetSubsystem<UGameplaySchedulerSubsystem>()->SetTimer(this, [this]
 		{
 			bIsSlideJumping = false;
 			GravityScale = DefaultGravityScale;
-		}, SlideJumpTime, false);
+		}, SlideJumpTime);
 
 		//call the blueprint event
 		OnPlayerSLideJump.Broadcast();
@@ -70,8 +70,15 @@ void URocketLauncherComponent::OnProjectileHit(AActor* Projectile, AActor* Other
 		return;
 	}
 
-	//destroy the projectile
-	Projectile->Destroy();
+	//release the projectile
+	ReleaseProjectile(Projectile);
+
+	//check if we should apply the native explosion
+	if (bUseNativeExplosion)
+	{
+		//apply the explosion at the impact point
+		GetWorld()->GetSubsystem<UExplosionSubsystem>()->Explode(Hit.ImpactPoint, ExplosionParams, GetOwner());
+	}
 
 	//check if the RocketExplosionClass is valid
 	if (RocketExplosionClass->IsValidLowLevelFast())
@@ -1,5 +1,7 @@
 #include "Components/TerrainGun/TerrainGunComponent.h"
 
+#include "Components/TerrainGun/TerrainPlacementSubsystem.h"
+
 UTerrainGunComponent::UTerrainGunComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
@@ -17,14 +19,8 @@ AActor* UTerrainGunComponent::FireProjectile(FVector Direction)
 		return nullptr;
 	}
 
-	//timer delegate to turn the projectile into terrain
-	FTimerDelegate TimerDelegate;
-
-	//bind the function to the delegate
-	TimerDelegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UTerrainGunComponent, OnProjectileExpired), SpawnedProjectile);
-
-	//bind the timer delegate to the timer handle
-	GetWorld()->GetTimerManager().SetTimer(TerrainTimerHandle, TimerDelegate, ProjectileLifeTime, false);
+	//turn the projectile into terrain when its time is up
+	GetWorld()->GetSubsystem<UTerrainPlacementSubsystem>()->ScheduleProjectileExpiry(this, SpawnedProjectile, ProjectileLifeTime);
 
 	//return the spawned projectile
 	return SpawnedProjectile;
@@ -32,11 +28,14 @@ AActor* UTerrainGunComponent::FireProjectile(FVector Direction)
 
 void UTerrainGunComponent::OnProjectileHit(AActor* Projectile, AActor* OtherActor, FVector NormalImpulse, const FHitResult& Hit)
 {
+	//stop the projectile from expiring
+	GetWorld()->GetSubsystem<UTerrainPlacementSubsystem>()->CancelProjectileExpiry(Projectile);
+
 	//check if the terrain class is invalid
-	if (!TerrainClass->IsValidLowLevel())
+	if (!TerrainMesh && !TerrainClass->IsValidLowLevel())
 	{
-		//destroy the projectile
-		Projectile->Destroy();
+		//release the projectile
+		ReleaseProjectile(Projectile);
 
 		//print an error message
 		UE_LOG(LogTemp, Error, TEXT("TerrainClass is not set in TerrainGunComponent"));
@@ -58,16 +57,29 @@ void UTerrainGunComponent::OnProjectileHit(AActor* Projectile, AActor* OtherActo
 	const FRotator TerrainRotation = Hit.ImpactNormal.Rotation();
 
 	//spawn the terrain
-	AActor* Terrain = GetWorld()->SpawnActor<AActor>(TerrainClass, TerrainLocation, TerrainRotation);
+	SpawnTerrain(TerrainLocation, TerrainRotation);
 
-	//destroy the projectile
-	Projectile->Destroy();
+	//release the projectile
+	ReleaseProjectile(Projectile);
+}
 
-	//call the OnTerrainSpawned delegate
-	OnTerrainSpawned.Broadcast(Terrain);
+void UTerrainGunComponent::OnSimulatedProjectileExpired(const FVector& Location, const FRotator& Rotation)
+{
+	//check if the terrain class is invalid
+	if (!TerrainMesh && !TerrainClass->IsValidLowLevel())
+	{
+		//print an error message
+		UE_LOG(LogTemp, Error, TEXT("TerrainClass is not set in TerrainGunComponent"));
+
+		//prevent further execution of this function
+		return;
+	}
+
+	//spawn the terrain where the projectile expired
+	SpawnTerrain(Location, Rotation);
 }
 
-void UTerrainGunComponent::OnProjectileExpired(AActor* Projectile) const
+void UTerrainGunComponent::OnProjectileExpired(AActor* Projectile)
 {
 	//assert that the projectile is valid
 	checkfSlow(Projectile, TEXT("Projectile is not valid in TerrainGunComponent"));
@@ -79,11 +91,23 @@ void UTerrainGunComponent::OnProjectileExpired(AActor* Projectile) const
 	const FRotator TerrainRotation = Projectile->GetActorRotation();
 
 	//spawn the terrain
-	AActor* Terrain = GetWorld()->SpawnActor<AActor>(TerrainClass, TerrainLocation, TerrainRotation);
+	SpawnTerrain(TerrainLocation, TerrainRotation);
+
+	//release the projectile
+	ReleaseProjectile(Projectile);
+}
+
+float UTerrainGunComponent::GetPooledProjectileLifeTime() const
+{
+	//the projectiles expire into terrain through the terrain placement subsystem instead of being released by the pool
+	return 0.f;
+}
+
+void UTerrainGunComponent::SpawnTerrain(const FVector& Location, const FRotator& Rotation)
+{
+	//place the terrain (the placement subsystem removes the oldest terrain if there's too much)
+	AActor* Terrain = GetWorld()->GetSubsystem<UTerrainPlacementSubsystem>()->PlaceTerrain(TerrainClass, TerrainMesh, FTransform(Rotation, Location, TerrainScale), MaxTerrainCount, TerrainLifeTime);
 
 	//call the OnTerrainSpawned delegate
 	OnTerrainSpawned.Broadcast(Terrain);
-
-	//destroy the projectile
-	Projectile->Destroy();
 }
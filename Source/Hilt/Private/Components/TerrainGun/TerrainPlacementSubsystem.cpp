@@ -0,0 +1,212 @@
+#include "Components/TerrainGun/TerrainPlacementSubsystem.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/TerrainGun/TerrainGunComponent.h"
+
+AActor* UTerrainPlacementSubsystem::PlaceTerrain(const TSubclassOf<AActor> TerrainClass, UStaticMesh* TerrainMesh, const FTransform& Transform, const int32 MaxTerrainCount, const float LifeTime)
+{
+	//check if there's nothing to place
+	if (!TerrainMesh && !TerrainClass)
+	{
+		return nullptr;
+	}
+
+	//remove the oldest terrain until there's room for the new terrain
+	while (MaxTerrainCount > 0 && Placements.Num() >= MaxTerrainCount)
+	{
+		RemovePlacement(0);
+	}
+
+	//the new placement
+	FTerrainPlacement Placement;
+	Placement.Id = NextId++;
+	Placement.MeshIndex = INDEX_NONE;
+	Placement.InstanceIndex = INDEX_NONE;
+
+	//storage for the actor to return
+	AActor* TerrainActor;
+
+	//check if the terrain is instanced
+	if (TerrainMesh)
+	{
+		//add an instance of the mesh
+		Placement.MeshIndex = GetMeshIndex(TerrainMesh);
+		Placement.InstanceIndex = InstanceComponents[Placement.MeshIndex]->AddInstance(Transform, true);
+
+		//return the actor holding the instances
+		TerrainActor = InstanceActor;
+	}
+	else
+	{
+		//spawn the terrain
+		TerrainActor = GetWorld()->SpawnActor<AActor>(TerrainClass, Transform);
+
+		//check if the terrain couldn't be spawned
+		if (!TerrainActor)
+		{
+			return nullptr;
+		}
+
+		//set the actor of the placement
+		Placement.Actor = TerrainActor;
+	}
+
+	//add the placement
+	Placements.Add(Placement);
+
+	//check if the terrain should expire
+	if (LifeTime > 0)
+	{
+		//remove the placement when its time is up
+		GetWorld()->GetSubsystem<UGameplaySchedulerSubsystem>()->SetTimer(this, [this, Id = Placement.Id]
+		{
+			//find the placement
+			const int32 PlacementIndex = Placements.IndexOfByPredicate([Id](const FTerrainPlacement& Other) { return Other.Id == Id; });
+
+			//check if the placement still exists (it can be recycled or cleared before it expires)
+			if (PlacementIndex != INDEX_NONE)
+			{
+				//remove the placement
+				RemovePlacement(PlacementIndex);
+			}
+		}, LifeTime);
+	}
+
+	//return the terrain actor
+	return TerrainActor;
+}
+
+void UTerrainPlacementSubsystem::ClearTerrain()
+{
+	//iterate through the placements
+	for (const FTerrainPlacement& Placement : Placements)
+	{
+		//check if the placement has an actor
+		if (AActor* Actor = Placement.Actor.Get())
+		{
+			//destroy the actor
+			Actor->Destroy();
+		}
+	}
+
+	//iterate through the instanced mesh components
+	for (UInstancedStaticMeshComponent* Component : InstanceComponents)
+	{
+		//check if the component is valid
+		if (Component)
+		{
+			//remove every instance
+			Component->ClearInstances();
+		}
+	}
+
+	//clear the placements (their expiry timers do nothing since their ids no longer exist)
+	Placements.Reset();
+}
+
+void UTerrainPlacementSubsystem::ScheduleProjectileExpiry(UTerrainGunComponent* Gun, AActor* Projectile, const float Delay)
+{
+	//get the scheduler
+	UGameplaySchedulerSubsystem* Scheduler = GetWorld()->GetSubsystem<UGameplaySchedulerSubsystem>();
+
+	//get the expiry timer of the projectile
+	FGameplayTimerHandle& TimerHandle = ProjectileExpiryTimers.FindOrAdd(Projectile);
+
+	//cancel an earlier expiry of the projectile
+	Scheduler->ClearTimer(TimerHandle);
+
+	//weak pointer to the projectile and its key in the expiry timers (the gun owns the timer so it isn't called if the gun is destroyed)
+	TWeakObjectPtr<AActor> WeakProjectile = Projectile;
+	TObjectKey<AActor> ProjectileKey = Projectile;
+
+	//set the expiry timer
+	TimerHandle = Scheduler->SetTimer(Gun, [this, Gun, WeakProjectile, ProjectileKey]
+	{
+		//remove the expiry timer of the projectile
+		ProjectileExpiryTimers.Remove(ProjectileKey);
+
+		//check if the projectile is still valid
+		if (AActor* ExpiredProjectile = WeakProjectile.Get())
+		{
+			//turn the projectile into terrain
+			Gun->OnProjectileExpired(ExpiredProjectile);
+		}
+	}, Delay);
+}
+
+void UTerrainPlacementSubsystem::CancelProjectileExpiry(const AActor* Projectile)
+{
+	//check if the projectile has an expiry timer
+	if (FGameplayTimerHandle* TimerHandle = ProjectileExpiryTimers.Find(Projectile))
+	{
+		//cancel the timer
+		GetWorld()->GetSubsystem<UGameplaySchedulerSubsystem>()->ClearTimer(*TimerHandle);
+		ProjectileExpiryTimers.Remove(Projectile);
+	}
+}
+
+void UTerrainPlacementSubsystem::RemovePlacement(const int32 PlacementIndex)
+{
+	//get the placement
+	const FTerrainPlacement& Placement = Placements[PlacementIndex];
+
+	//check if the placement is instanced
+	if (Placement.MeshIndex != INDEX_NONE)
+	{
+		//check if the instanced mesh component is still valid
+		if (UInstancedStaticMeshComponent* Component = InstanceComponents[Placement.MeshIndex])
+		{
+			//remove the instance
+			Component->RemoveInstance(Placement.InstanceIndex);
+		}
+
+		//iterate through the placements of the same mesh
+		for (FTerrainPlacement& OtherPlacement : Placements)
+		{
+			//check if the instance came after the removed instance
+			if (OtherPlacement.MeshIndex == Placement.MeshIndex && OtherPlacement.InstanceIndex > Placement.InstanceIndex)
+			{
+				//move the index down since the component keeps the order of its instances
+				--OtherPlacement.InstanceIndex;
+			}
+		}
+	}
+	else if (AActor* Actor = Placement.Actor.Get())
+	{
+		//destroy the actor
+		Actor->Destroy();
+	}
+
+	//remove the placement (keeping the oldest placement first)
+	Placements.RemoveAt(PlacementIndex);
+}
+
+int32 UTerrainPlacementSubsystem::GetMeshIndex(UStaticMesh* Mesh)
+{
+	//check if we already have a component for the mesh
+	const int32 ExistingIndex = InstanceComponents.IndexOfByPredicate([Mesh](const UInstancedStaticMeshComponent* Component) { return Component && Component->GetStaticMesh() == Mesh; });
+	if (ExistingIndex != INDEX_NONE)
+	{
+		return ExistingIndex;
+	}
+
+	//check if we need to spawn the actor holding the components
+	if (!InstanceActor)
+	{
+		//spawn the actor
+		InstanceActor = GetWorld()->SpawnActor<AActor>();
+		InstanceActor->SetRootComponent(NewObject<USceneComponent>(InstanceActor));
+		InstanceActor->GetRootComponent()->RegisterComponent();
+	}
+
+	//create the instanced mesh component (every instance collides as part of the one component)
+	UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(InstanceActor);
+	Component->SetStaticMesh(Mesh);
+	Component->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+	Component->SetMobility(EComponentMobility::Movable);
+	Component->SetupAttachment(InstanceActor->GetRootComponent());
+	Component->RegisterComponent();
+
+	//add the component
+	return InstanceComponents.Add(Component);
+}
@@ -0,0 +1,223 @@
+#include "Core/ActorTagSubsystem.h"
+
+#include "EngineUtils.h"
+#include "Engine/Level.h"
+
+void UActorTagSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	//call the parent implementation
+	Super::Initialize(Collection);
+
+	//get the world
+	UWorld* World = GetWorld();
+
+	//bind to the actors being spawned and destroyed
+	ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UActorTagSubsystem::OnActorSpawned));
+	ActorDestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &UActorTagSubsystem::OnActorDestroyed));
+
+	//bind to the levels being streamed in (levels being hidden keep their actors, so they stay indexed)
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UActorTagSubsystem::OnLevelAddedToWorld);
+}
+
+void UActorTagSubsystem::Deinitialize()
+{
+	//get the world
+	UWorld* World = GetWorld();
+
+	//unbind from the actors being spawned and destroyed
+	World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+
+	//unbind from the levels being streamed in
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+
+	//clear the index
+	TaggedActors.Reset();
+	bWorldIndexed = false;
+
+	//call the parent implementation
+	Super::Deinitialize();
+}
+
+void UActorTagSubsystem::AddTag(AActor* Actor, const FName Tag)
+{
+	//check if the actor is invalid
+	if (!Actor)
+	{
+		return;
+	}
+
+	//add the tag to the actor
+	Actor->Tags.AddUnique(Tag);
+
+	//add the actor to the set of the tag
+	TaggedActors.FindOrAdd(Tag).Add(Actor);
+}
+
+void UActorTagSubsystem::RemoveTag(AActor* Actor, const FName Tag)
+{
+	//check if the actor is invalid
+	if (!Actor)
+	{
+		return;
+	}
+
+	//remove the tag from the actor
+	Actor->Tags.Remove(Tag);
+
+	//check if the tag has a set
+	if (TSet<TObjectKey<AActor>>* Actors = TaggedActors.Find(Tag))
+	{
+		//remove the actor from the set of the tag
+		Actors->Remove(Actor);
+	}
+}
+
+bool UActorTagSubsystem::HasTag(const AActor* Actor, const FName Tag)
+{
+	//make sure the world is indexed
+	IndexWorld();
+
+	//get the set of the tag
+	const TSet<TObjectKey<AActor>>* Actors = TaggedActors.Find(Tag);
+
+	//return whether or not the actor is in the set
+	return Actor && Actors && Actors->Contains(TObjectKey<AActor>(Actor));
+}
+
+void UActorTagSubsystem::GetActorsWithTag(const FName Tag, TArray<AActor*>& OutActors)
+{
+	//make sure the world is indexed
+	IndexWorld();
+
+	//clear the output (keeping the memory)
+	OutActors.Reset();
+
+	//check if the tag has a set
+	if (TSet<TObjectKey<AActor>>* Actors = TaggedActors.Find(Tag))
+	{
+		//iterate through the actors of the tag
+		for (auto It = Actors->CreateIterator(); It; ++It)
+		{
+			//check if the actor is still valid
+			if (AActor* Actor = It->ResolveObjectPtr())
+			{
+				//add the actor to the output
+				OutActors.Add(Actor);
+			}
+			else
+			{
+				//remove the actor (its level was unloaded without destroying it)
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+int32 UActorTagSubsystem::GetNumActorsWithTag(const FName Tag)
+{
+	//make sure the world is indexed
+	IndexWorld();
+
+	//check if the tag has no set
+	TSet<TObjectKey<AActor>>* Actors = TaggedActors.Find(Tag);
+	if (!Actors)
+	{
+		return 0;
+	}
+
+	//remove the actors that no longer exist (their level was unloaded without destroying them)
+	for (auto It = Actors->CreateIterator(); It; ++It)
+	{
+		if (!It->ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	//return the number of actors in the set
+	return Actors->Num();
+}
+
+void UActorTagSubsystem::IndexWorld()
+{
+	//check if the world is already indexed
+	if (bWorldIndexed)
+	{
+		return;
+	}
+
+	//set the world as indexed
+	bWorldIndexed = true;
+
+	//iterate through every actor of the world
+	for (TActorIterator<AActor> It(GetWorld()); It; ++It)
+	{
+		//index the actor
+		IndexActor(*It);
+	}
+}
+
+void UActorTagSubsystem::IndexActor(AActor* Actor)
+{
+	//check if the actor is invalid
+	if (!Actor)
+	{
+		return;
+	}
+
+	//iterate through the tags of the actor
+	for (const FName& Tag : Actor->Tags)
+	{
+		//add the actor to the set of the tag
+		TaggedActors.FindOrAdd(Tag).Add(Actor);
+	}
+}
+
+void UActorTagSubsystem::UnindexActor(AActor* Actor)
+{
+	//check if the actor is invalid
+	if (!Actor)
+	{
+		return;
+	}
+
+	//iterate through the tags of the actor
+	for (const FName& Tag : Actor->Tags)
+	{
+		//check if the tag has a set
+		if (TSet<TObjectKey<AActor>>* Actors = TaggedActors.Find(Tag))
+		{
+			//remove the actor from the set of the tag
+			Actors->Remove(Actor);
+		}
+	}
+}
+
+void UActorTagSubsystem::OnActorSpawned(AActor* Actor)
+{
+	//index the spawned actor
+	IndexActor(Actor);
+}
+
+void UActorTagSubsystem::OnActorDestroyed(AActor* Actor)
+{
+	//remove the destroyed actor from the index
+	UnindexActor(Actor);
+}
+
+void UActorTagSubsystem::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	//check if the level isn't part of our world or the world hasn't been indexed yet (it'll be indexed with the world)
+	if (World != GetWorld() || !Level || !bWorldIndexed)
+	{
+		return;
+	}
+
+	//iterate through the actors of the level
+	for (AActor* Actor : Level->Actors)
+	{
+		//index the actor
+		IndexActor(Actor);
+	}
+}
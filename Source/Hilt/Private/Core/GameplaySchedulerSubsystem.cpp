@@ -0,0 +1,299 @@
+#include "Core/GameplaySchedulerSubsystem.h"
+
+UGameplaySchedulerSubsystem::UGameplaySchedulerSubsystem()
+{
+}
+
+void UGameplaySchedulerSubsystem::Tick(const float DeltaTime)
+{
+	//call the parent implementation
+	Super::Tick(DeltaTime);
+
+	//reset the stats of the last frame
+	Stats.NumFiredLastFrame = 0;
+	Stats.NumStepsLastFrame = 0;
+
+	//add the time since the last tick
+	StepTimeAccumulator += DeltaTime;
+
+	//take a step for every step time that passed
+	while (StepTimeAccumulator >= StepTime)
+	{
+		//remove the step time
+		StepTimeAccumulator -= StepTime;
+
+		//take the step
+		Step();
+		++Stats.NumStepsLastFrame;
+	}
+}
+
+TStatId UGameplaySchedulerSubsystem::GetStatId() const
+{
+	return TStatId();
+}
+
+FGameplayTimerHandle UGameplaySchedulerSubsystem::SetTimer(const UObject* Owner, TFunction<void()>&& Callback, const float Delay, const bool bLoop)
+{
+	//check if the owner is invalid (timers without an owner would never fire)
+	if (!Owner)
+	{
+		//print an error message
+		UE_LOG(LogTemp, Error, TEXT("Timer set without an owner in GameplaySchedulerSubsystem"));
+
+		//return an invalid handle
+		return FGameplayTimerHandle();
+	}
+
+	//get a free timer (reusing a freed one if we can)
+	const int32 Index = FreeIndices.Num() > 0 ? FreeIndices.Pop(EAllowShrinking::No) : Timers.AddDefaulted();
+	FScheduledTimer& Timer = Timers[Index];
+
+	//set the timer
+	Timer.Callback = MoveTemp(Callback);
+	Timer.Owner = Owner;
+	Timer.ExpireStep = CurrentStep + GetStepsForDelay(Delay);
+	Timer.IntervalSteps = bLoop ? FMath::Max(1, FMath::RoundToInt(Delay / StepTime)) : 0;
+	Timer.bActive = true;
+
+	//add the timer to the wheel
+	InsertTimer(Index);
+
+	//update the stats
+	++Stats.NumPending;
+	Stats.PeakPending = FMath::Max(Stats.PeakPending, Stats.NumPending);
+
+	//return the handle of the timer
+	FGameplayTimerHandle Handle;
+	Handle.Index = Index;
+	Handle.Serial = Timer.Serial;
+	return Handle;
+}
+
+void UGameplaySchedulerSubsystem::ClearTimer(FGameplayTimerHandle& Handle)
+{
+	//check if the timer is active
+	if (IsTimerActive(Handle))
+	{
+		//free the timer (its wheel entry is skipped)
+		FreeTimer(Handle.Index);
+	}
+
+	//invalidate the handle
+	Handle.Invalidate();
+}
+
+int32 UGameplaySchedulerSubsystem::ClearTimersForOwner(const UObject* Owner)
+{
+	//storage for the number of timers cancelled
+	int32 NumCleared = 0;
+
+	//iterate through the timers
+	for (int Index = 0; Index < Timers.Num(); ++Index)
+	{
+		//check if the timer is active and belongs to the owner
+		if (Timers[Index].bActive && Timers[Index].Owner == Owner)
+		{
+			//free the timer
+			FreeTimer(Index);
+			++NumCleared;
+		}
+	}
+
+	//return the number of timers cancelled
+	return NumCleared;
+}
+
+void UGameplaySchedulerSubsystem::ClearAllTimers()
+{
+	//iterate through the timers
+	for (int Index = 0; Index < Timers.Num(); ++Index)
+	{
+		//check if the timer is active
+		if (Timers[Index].bActive)
+		{
+			//free the timer
+			FreeTimer(Index);
+		}
+	}
+
+	//clear the slots of the wheel (keeping their memory)
+	for (TArray<FWheelEntry>& Slot : Wheel)
+	{
+		Slot.Reset();
+	}
+}
+
+bool UGameplaySchedulerSubsystem::IsTimerActive(const FGameplayTimerHandle& Handle) const
+{
+	//return whether or not the handle refers to an active timer
+	return Timers.IsValidIndex(Handle.Index) && Timers[Handle.Index].bActive && Timers[Handle.Index].Serial == Handle.Serial;
+}
+
+float UGameplaySchedulerSubsystem::GetTimerRemaining(const FGameplayTimerHandle& Handle) const
+{
+	//check if the timer isn't active
+	if (!IsTimerActive(Handle))
+	{
+		return -1;
+	}
+
+	//return the time until the timer's step
+	return FMath::Max(0.f, (Timers[Handle.Index].ExpireStep - CurrentStep) * StepTime - StepTimeAccumulator);
+}
+
+void UGameplaySchedulerSubsystem::Step()
+{
+	//move to the next step
+	++CurrentStep;
+
+	//get the slot of the first level
+	const int32 FirstSlot = CurrentStep & SlotMask;
+
+	//check if the first level wrapped around
+	if (FirstSlot == 0)
+	{
+		//move the timers of the next slot of each level down (stopping at the first level that didn't wrap around)
+		for (int Level = 1; Level < NumLevels; ++Level)
+		{
+			//get the slot of the level
+			const int32 Slot = (CurrentStep >> (Level * SlotBits)) & SlotMask;
+
+			//move the timers of the slot down
+			CascadeSlot(Level, Slot);
+
+			//check if the level didn't wrap around
+			if (Slot != 0)
+			{
+				break;
+			}
+		}
+	}
+
+	//take the entries of the slot (new timers set while firing never land in this slot)
+	TArray<FWheelEntry> Entries = MoveTemp(GetSlot(0, FirstSlot));
+
+	//iterate through the entries
+	for (const FWheelEntry& Entry : Entries)
+	{
+		//check if the timer was cancelled
+		if (!IsEntryActive(Entry))
+		{
+			continue;
+		}
+
+		//check if the owner of the timer was destroyed
+		if (!Timers[Entry.Index].Owner.IsValid())
+		{
+			//free the timer without firing it
+			FreeTimer(Entry.Index);
+			continue;
+		}
+
+		//take the callback out of the timer (the timers can be reallocated while it's running)
+		TFunction<void()> Callback = MoveTemp(Timers[Entry.Index].Callback);
+
+		//check if the timer is looping
+		if (Timers[Entry.Index].IntervalSteps > 0)
+		{
+			//reschedule the timer from the step it was meant to fire on (so it doesn't drift)
+			Timers[Entry.Index].ExpireStep += Timers[Entry.Index].IntervalSteps;
+			InsertTimer(Entry.Index);
+		}
+
+		//fire the timer
+		Callback();
+		++Stats.NumFiredLastFrame;
+		++Stats.TotalFired;
+
+		//check if the timer is still active (it could've been cancelled by its own callback)
+		if (IsEntryActive(Entry))
+		{
+			//check if the timer is looping
+			if (Timers[Entry.Index].IntervalSteps > 0)
+			{
+				//put the callback back
+				Timers[Entry.Index].Callback = MoveTemp(Callback);
+			}
+			else
+			{
+				//free the timer
+				FreeTimer(Entry.Index);
+			}
+		}
+	}
+
+	//put the storage of the entries back in the slot (so it doesn't reallocate)
+	Entries.Reset();
+	GetSlot(0, FirstSlot) = MoveTemp(Entries);
+}
+
+void UGameplaySchedulerSubsystem::InsertTimer(const int32 Index)
+{
+	//get the number of steps until the timer fires
+	const uint64 ExpireStep = Timers[Index].ExpireStep;
+	const uint64 Delta = ExpireStep > CurrentStep ? ExpireStep - CurrentStep : 0;
+
+	//iterate through the levels
+	for (int Level = 0; Level < NumLevels; ++Level)
+	{
+		//check if the timer fires within the range of the level
+		if (Delta < (uint64(1) << ((Level + 1) * SlotBits)))
+		{
+			//add the timer to the slot of its step on this level
+			GetSlot(Level, (ExpireStep >> (Level * SlotBits)) & SlotMask).Add({ Index, Timers[Index].Serial });
+			return;
+		}
+	}
+
+	//add the timer to the furthest slot of the last level (it's added to the wheel again when the slot is reached)
+	const uint64 FurthestStep = CurrentStep + (uint64(1) << (NumLevels * SlotBits)) - 1;
+	GetSlot(NumLevels - 1, (FurthestStep >> ((NumLevels - 1) * SlotBits)) & SlotMask).Add({ Index, Timers[Index].Serial });
+}
+
+void UGameplaySchedulerSubsystem::CascadeSlot(const int32 Level, const int32 Slot)
+{
+	//take the entries of the slot
+	TArray<FWheelEntry> Entries = MoveTemp(GetSlot(Level, Slot));
+
+	//iterate through the entries
+	for (const FWheelEntry& Entry : Entries)
+	{
+		//check if the timer is still active
+		if (IsEntryActive(Entry))
+		{
+			//add the timer to the wheel again (it lands on a lower level now that it's closer)
+			InsertTimer(Entry.Index);
+		}
+	}
+}
+
+void UGameplaySchedulerSubsystem::FreeTimer(const int32 Index)
+{
+	//get the timer
+	FScheduledTimer& Timer = Timers[Index];
+
+	//deactivate the timer and change its serial so old handles and wheel entries stop working
+	Timer.bActive = false;
+	++Timer.Serial;
+	Timer.Callback.Reset();
+	Timer.Owner.Reset();
+
+	//add the timer to the free timers
+	FreeIndices.Add(Index);
+
+	//update the stats
+	--Stats.NumPending;
+}
+
+bool UGameplaySchedulerSubsystem::IsEntryActive(const FWheelEntry& Entry) const
+{
+	//return whether or not the entry refers to the current use of an active timer
+	return Timers[Entry.Index].bActive && Timers[Entry.Index].Serial == Entry.Serial;
+}
+
+uint32 UGameplaySchedulerSubsystem::GetStepsForDelay(const float Delay) const
+{
+	//get the number of steps until the delay has passed, including the time already passed towards the next step
+	return FMath::Max(1, FMath::CeilToInt((Delay + StepTimeAccumulator) / StepTime - KINDA_SMALL_NUMBER));
+}
@@ -7,8 +7,14 @@
 #include "InteractableObjects/PylonObjective.h"
 #include "NPC/Enemies/BaseEnemy.h"
 #include "Hilt/Public/Core/HiltTags.h"
+#include "Core/RunTimerSubsystem.h"
+#include "Core/ObjectiveRegistrySubsystem.h"
+#include "Core/StreamingManagerSubsystem.h"
+#include "Helpers/SimulatedProjectileSubsystem.h"
+#include "Components/TerrainGun/TerrainPlacementSubsystem.h"
 
 // Other Includes
+#include "Components/PlayerMovementComponent.h"
 #include "Components/RocketLauncherComponent.h"
 #include "Components/GrapplingHook/GrapplingComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -25,36 +31,26 @@ void AHiltGameModeBase::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Adds All streaming levels to default levels array
+	// Adds All streaming levels to default levels array (names come from the streaming manager's level map)
 	StreamingLevels = GetWorld()->GetStreamingLevels();
-	for (ULevelStreaming* Level : StreamingLevels)
-		if (Level)
-			if (Level->GetLevelStreamingState() == ELevelStreamingState::LoadedVisible)
-			{
-				//find the part of the string after the last underscore
-				FString LevelName = Level->GetWorldAssetPackageFName().ToString();
-				LevelName = LevelName.RightChop(LevelName.Find("_0_") + 3);
-
-				//add the level to the levels to show array
-				DefaultLevelsToShow.Add(*LevelName);
-			}
-			else
-			{
-				//find the part of the string after the last underscore
-				FString LevelName = Level->GetWorldAssetPackageFName().ToString();
-				LevelName = LevelName.RightChop(LevelName.Find("_0_") + 3);
-
-				//add the level to the levels to show array
-				LevelsToHide.Add(*LevelName);
-			}
+	if (UStreamingManagerSubsystem* StreamingManager = GetWorld()->GetSubsystem<UStreamingManagerSubsystem>())
+	{
+		StreamingManager->BuildLevelMap();
+		StreamingManager->GetLevelNames(DefaultLevelsToShow, LevelsToHide);
+	}
 
 	ShowAllStreamingLevels();
+
+	// Starts the run timer
+	if (TimerShouldTick)
+		StartTimer();
 	
-	// Gets all objectives and sets num for win condition
-	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), APylonObjective::StaticClass(), FoundActors);
-	NumActiveObjectives = FoundActors.Num();
-	TotalNumActiveObjectives = FoundActors.Num();
+	// Gets the objective counts for the win condition from the registry (objectives register themselves)
+	if (UObjectiveRegistrySubsystem* ObjectiveRegistry = GetWorld()->GetSubsystem<UObjectiveRegistrySubsystem>())
+	{
+		ObjectiveRegistry->OnObjectiveCountChanged.AddDynamic(this, &AHiltGameModeBase::OnObjectiveCountChanged);
+		OnObjectiveCountChanged(ObjectiveRegistry->GetNumActiveObjectives(), ObjectiveRegistry->GetNumObjectives());
+	}
 
 	TArray<AActor*> SpawnActors;
 	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ASpawnPoint::StaticClass(), SpawnActors);
@@ -72,10 +68,14 @@ void AHiltGameModeBase::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	if (TimerShouldTick)
+	// Keeps the run timer in sync with TimerShouldTick (can be set from blueprints)
+	if (URunTimerSubsystem* RunTimer = GetRunTimer())
 	{
-		TotalElapsedTime += DeltaTime;
-		LocalElapsedTime += DeltaTime;
+		if (TimerShouldTick && !RunTimer->IsRunning())
+			RunTimer->ResumeRun();
+		else if (!TimerShouldTick && RunTimer->IsRunning())
+			RunTimer->PauseRun();
+
 		CountTime();
 	}
 
@@ -84,10 +84,17 @@ void AHiltGameModeBase::Tick(float DeltaTime)
 		if (APlayerController* PC = World->GetFirstPlayerController())
 			if (APlayerCharacter* PlayerCharacter = Cast<APlayerCharacter>(PC->GetPawn()))
 			{
-				// All objectives taken 
-				if(NumActiveObjectives <= 0 && DoObjectivesOnce)
+				// All objectives taken (maps without objectives never finish a run)
+				if(TotalNumActiveObjectives > 0 && NumActiveObjectives <= 0 && DoObjectivesOnce)
 				{
 					DoObjectivesOnce = false;
+
+					// Finishes the run and stops the timer
+					if (URunTimerSubsystem* RunTimer = GetRunTimer())
+						RunTimer->FinishRun();
+					TimerShouldTick = false;
+					CountTime();
+
 					PlayerCharacter->OnPlayerPickedUpAllObjectives();
 				}
 			}
@@ -97,28 +104,16 @@ void AHiltGameModeBase::RestartLevel()
 {
 	if (!canRestart) return;
 
+	// Cancels the game mode's pending timers (launch pads and the player clear their own when they reset, projectile expiries keep running)
+	GetWorld()->GetSubsystem<UGameplaySchedulerSubsystem>()->ClearTimersForOwner(this);
+
 	//ShowAllStreamingLevels();
 	// Restarts timer
-	ResetTimer();
-
-	// RESET OBJECTIVES
-	TArray<AActor*> PylonActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), APylonObjective::StaticClass(), PylonActors);
-
-	for (AActor* object : PylonActors)
-	{
-		if (APylonObjective* objective = Cast<APylonObjective>(object))
-		{
-			if (!objective->IsActive())
-			{
-				objective->AddLevelPresence();
-				objective->DisableOnce = true;
-			}
-		}
+	StartTimer();
 
-		// Reset NumActiveObjectives
-		NumActiveObjectives = TotalNumActiveObjectives;
-	}
+	// RESET OBJECTIVES (the objectives reset themselves and the counts come back through OnObjectiveCountChanged)
+	if (UObjectiveRegistrySubsystem* ObjectiveRegistry = GetWorld()->GetSubsystem<UObjectiveRegistrySubsystem>())
+		ObjectiveRegistry->ResetObjectives();
 
 	// Get all actors with reset JUMPPADS
 	TArray<AActor*> LaunchActors;
@@ -132,6 +127,14 @@ void AHiltGameModeBase::RestartLevel()
 		}
 	}
 
+	// Reset placed terrain
+	if (UTerrainPlacementSubsystem* TerrainPlacement = GetWorld()->GetSubsystem<UTerrainPlacementSubsystem>())
+		TerrainPlacement->ClearTerrain();
+
+	// Reset simulated projectiles
+	if (USimulatedProjectileSubsystem* SimulatedProjectiles = GetWorld()->GetSubsystem<USimulatedProjectileSubsystem>())
+		SimulatedProjectiles->ClearProjectiles();
+
 	// RESET SPAWNPOINT AND PLAYER
 	for(ASpawnPoint* spawnPoint : LevelSpawnPoints)
 	{
@@ -152,6 +155,7 @@ void AHiltGameModeBase::RestartLevel()
 							PlayerCharacter->RocketLauncherComponent->ResetRocketLauncher();
 							PlayerCharacter->ScoreComponent->ResetScore();
 							PlayerCharacter->GrappleComponent->StopGrapple(false);
+							PlayerCharacter->PlayerMovementComponent->ResetTransientState();
 
 							//array for projectile actors
 							TArray<AActor*> ProjectileActors;
@@ -159,11 +163,11 @@ void AHiltGameModeBase::RestartLevel()
 							//get all actors of the projectile class
 							UGameplayStatics::GetAllActorsOfClass(GetWorld(), PlayerCharacter->RocketLauncherComponent->ProjectileClass, ProjectileActors);
 
-							//reset(destroy) projectile actors
+							//reset(release) projectile actors (pooled projectiles go back to the pool, the rest are destroyed)
 							for (AActor* Actor : ProjectileActors)
 							{
-								//destroy the projectile
-								Actor->Destroy();
+								//release the projectile
+								PlayerCharacter->RocketLauncherComponent->ReleaseProjectile(Actor);
 							}
 						} else {
 							// Player location
@@ -177,6 +181,7 @@ void AHiltGameModeBase::RestartLevel()
 							PlayerCharacter->RocketLauncherComponent->CurrentAmmo = PlayerCharacter->RocketLauncherComponent->StartingAmmo;
 							PlayerCharacter->ScoreComponent->ResetScore();
 							PlayerCharacter->GrappleComponent->StopGrapple(false);
+							PlayerCharacter->PlayerMovementComponent->ResetTransientState();
 
 							//array for projectile actors
 							TArray<AActor*> ProjectileActors;
@@ -184,11 +189,11 @@ void AHiltGameModeBase::RestartLevel()
 							//get all actors of the projectile class
 							UGameplayStatics::GetAllActorsOfClass(GetWorld(), PlayerCharacter->RocketLauncherComponent->ProjectileClass, ProjectileActors);
 
-							//reset(destroy) projectile actors
+							//reset(release) projectile actors (pooled projectiles go back to the pool, the rest are destroyed)
 							for (AActor* Actor : ProjectileActors)
 							{
-								//destroy the projectile
-								Actor->Destroy();
+								//release the projectile
+								PlayerCharacter->RocketLauncherComponent->ReleaseProjectile(Actor);
 							}
 						}
 				
@@ -206,7 +211,7 @@ void AHiltGameModeBase::RestartLevel()
 	//}
 
 	OnRestartLevelCustom();
-	GetWorld()->GetTimerManager().SetTimer(RestartCooldownHandler, this, &AHiltGameModeBase::RestartCooldownComplete, RestartCooldown, false);
+	RestartCooldownHandler = GetWorld()->GetSubsystem<UGameplaySchedulerSubsystem>()->SetTimer(this, &AHiltGameModeBase::RestartCooldownComplete, RestartCooldown);
 
 	DoObjectivesOnce = true;
 	canRestart = false;
@@ -222,36 +227,24 @@ void AHiltGameModeBase::RestartCooldownComplete()
 void AHiltGameModeBase::ShowAllStreamingLevels()
 {
 	// Enables visibility on all levels
-	for (ULevelStreaming* Level : StreamingLevels)
-	{
-		Level->SetShouldBeVisible(true);
-		if(Level->IsLevelVisible())
-			GEngine->AddOnScreenDebugMessage(-1, 3.f, FColor::Red, TEXT("LevelVis"));
-	}
+	if (UStreamingManagerSubsystem* StreamingManager = GetWorld()->GetSubsystem<UStreamingManagerSubsystem>())
+		StreamingManager->ShowAllLevels();
 }
 
 void AHiltGameModeBase::HideNotDefaultStreamingLevels()
 {
-	//iterate over the streaming levels
-	for (ULevelStreaming* Level : StreamingLevels)
+	//request the non default levels to be hidden
+	if (UStreamingManagerSubsystem* StreamingManager = GetWorld()->GetSubsystem<UStreamingManagerSubsystem>())
 	{
-		//check if the level is valid
-		if (Level)
-		{
-			//iterate over the levels to show
-			for (FName LevelName : LevelsToHide)
-			{
-				//check if the level is in the levels to load array
-				if (Level->GetWorldAssetPackageFName().ToString().Contains(*LevelName.ToString()))
-				{
-					//set the next level to be visible
-					Level->SetShouldBeVisible(false);
-				}
-			}
-		}
+		StreamingManager->RequestHideLevels(LevelsToHide);
 	}
 }
 
+URunTimerSubsystem* AHiltGameModeBase::GetRunTimer() const
+{
+	return GetWorld() ? GetWorld()->GetSubsystem<URunTimerSubsystem>() : nullptr;
+}
+
 void AHiltGameModeBase::RestartLevelBP()
 {
 	RestartLevel();
@@ -260,44 +253,47 @@ void AHiltGameModeBase::RestartLevelBP()
 void AHiltGameModeBase::StartTimer()
 {
 	TimerShouldTick = true;
-	TotalElapsedTime = 0.0f;
+
+	// Starts a new run from 0
+	if (URunTimerSubsystem* RunTimer = GetRunTimer())
+		RunTimer->StartRun();
+
+	CountTime();
 }
 
 void AHiltGameModeBase::StopTimer()
 {
 	TimerShouldTick = false;
+
+	if (URunTimerSubsystem* RunTimer = GetRunTimer())
+		RunTimer->PauseRun();
 }
 
 void AHiltGameModeBase::ResetTimer()
 {
-	TotalElapsedTime = 0.0f;
-	LocalElapsedTime = 0.0f;
-	//LocalMillisecs = 0.0f;
-	Millisecs = 0.f;
-	Seconds = 0;
-	Minutes = 0;
+	if (URunTimerSubsystem* RunTimer = GetRunTimer())
+		RunTimer->ResetRun();
+
+	CountTime();
 }
 
 void AHiltGameModeBase::CountTime()
 {
-	// Calculate the milliseconds
-	Millisecs = LocalElapsedTime;
+	// Gets the elapsed time in double precision so long sessions don't drift
+	const URunTimerSubsystem* RunTimer = GetRunTimer();
+	const double ElapsedTime = RunTimer ? RunTimer->GetElapsedTime() : 0.0;
+	const double WholeSeconds = FMath::FloorToDouble(ElapsedTime);
 
-	//Millisecs = (int)(LocalMillisecs*100);
+	TotalElapsedTime = static_cast<float>(ElapsedTime);
 
-	// Calculate the seconds
-	if (Millisecs >= 1.0f)
-	{
-		Seconds += 1;
-		LocalElapsedTime = 0.0f;
-	}
+	// Calculate the milliseconds (fraction of the current second)
+	Millisecs = static_cast<float>(ElapsedTime - WholeSeconds);
+	LocalElapsedTime = Millisecs;
 
-	// Calculate the minutes
-	if(Seconds >= 60)
-	{
-		Minutes += 1;
-		Seconds = 0;
-	}
+	// Calculate the seconds and minutes
+	const int64 TotalSeconds = static_cast<int64>(WholeSeconds);
+	Seconds = static_cast<int>(TotalSeconds % 60);
+	Minutes = static_cast<int>(TotalSeconds / 60);
 
 	// Debug: Print elapsed time
 	//GEngine->AddOnScreenDebugMessage(5, 1.f, FColor::Orange, FString::Printf(TEXT("Minutes: %i Seconds: %i Milliseconds: %f"), Minutes, Seconds, Millisecs));
@@ -305,3 +301,10 @@ void AHiltGameModeBase::CountTime()
 	//GEngine->AddOnScreenDebugMessage(7, 1.f, FColor::Orange, FString::Printf(TEXT("Local Elapsed time: %f"), LocalElapsedTime));
 }
 
+
+void AHiltGameModeBase::OnObjectiveCountChanged(int32 NumActive, int32 NumTotal)
+{
+	// Keeps the win condition counts in sync with the objective registry
+	NumActiveObjectives = NumActive;
+	TotalNumActiveObjectives = NumTotal;
+}
@@ -0,0 +1,286 @@
+#include "Core/LeaderboardSubsystem.h"
+
+#include "Algo/BinarySearch.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+bool ULeaderboardSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	//only keep leaderboards for worlds that are played
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void ULeaderboardSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	//call the parent implementation
+	Super::Initialize(Collection);
+
+	//get the path of the leaderboard file and load it
+	LeaderboardPath = GetLeaderboardPath();
+	LoadLeaderboard();
+
+	//make sure the run timer exists and add finished runs to the leaderboard
+	URunTimerSubsystem* RunTimer = Collection.InitializeDependency<URunTimerSubsystem>();
+	RunTimer->OnRunFinished.AddDynamic(this, &ULeaderboardSubsystem::OnRunFinished);
+
+	//set the personal best of the run timer from the leaderboard
+	if (SortedIndex.Num() > 0)
+	{
+		//get the best record
+		const FLeaderboardFileRecord& Best = Records[SortedIndex[0].RecordIndex];
+
+		//create the personal best from the best record
+		FRunTimerRecord PersonalBest;
+		PersonalBest.TotalTime = Best.TotalTime;
+		PersonalBest.Splits.Append(Best.Splits, FMath::Clamp(Best.NumSplits, 0, FLeaderboardFileRecord::MaxSplits));
+
+		//set the personal best
+		RunTimer->SetPersonalBest(PersonalBest);
+	}
+}
+
+void ULeaderboardSubsystem::Deinitialize()
+{
+	//wait for any pending writes so no run is lost
+	LastWrite.Wait();
+
+	//call the parent implementation
+	Super::Deinitialize();
+}
+
+int32 ULeaderboardSubsystem::SubmitRun(const FRunTimerRecord& Record, const FGuid& GhostId)
+{
+	//create the stored record
+	FLeaderboardFileRecord FileRecord;
+	FileRecord.TotalTime = Record.TotalTime;
+	FileRecord.DateTicks = FDateTime::UtcNow().GetTicks();
+	FileRecord.GhostId = GhostId;
+	FileRecord.NumSplits = FMath::Min(Record.Splits.Num(), FLeaderboardFileRecord::MaxSplits);
+
+	//check if the run has more splits than can be stored
+	if (Record.Splits.Num() > FLeaderboardFileRecord::MaxSplits)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Leaderboard: run has %d splits, only the first %d are stored"), Record.Splits.Num(), FLeaderboardFileRecord::MaxSplits);
+	}
+
+	//copy the splits
+	FMemory::Memcpy(FileRecord.Splits, Record.Splits.GetData(), FileRecord.NumSplits * sizeof(double));
+
+	//add the record to the leaderboard
+	AddRecord(FileRecord);
+
+	//get where the record goes in the file (after the header and every record before it, so the records stay aligned)
+	const int64 Offset = sizeof(FLeaderboardFileHeader) + static_cast<int64>(Records.Num() - 1) * sizeof(FLeaderboardFileRecord);
+
+	//write the record to the file on the write pipe (the first write also creates the file and its header)
+	LastWrite = WritePipe.Launch(UE_SOURCE_LOCATION, [Path = LeaderboardPath, FileRecord, Offset]()
+	{
+		//get the platform file
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		//make sure the directory exists
+		PlatformFile.CreateDirectoryTree(*FPaths::GetPath(Path));
+
+		//open the file for appending
+		const TUniquePtr<IFileHandle> Handle(PlatformFile.OpenWrite(*Path, true));
+
+		//check if the file couldn't be opened
+		if (!Handle)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Leaderboard: failed to open %s for writing"), *Path);
+			return;
+		}
+
+		//check if the file is new
+		if (Handle->Size() == 0)
+		{
+			//write the header
+			const FLeaderboardFileHeader Header;
+			Handle->Write(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+		}
+
+		//write the record at its offset
+		Handle->Seek(Offset);
+		Handle->Write(reinterpret_cast<const uint8*>(&FileRecord), sizeof(FileRecord));
+	});
+
+	//return the rank of the run
+	return GetRankForTime(FileRecord.TotalTime);
+}
+
+TArray<FLeaderboardRun> ULeaderboardSubsystem::GetTopRuns(const int32 Count) const
+{
+	//storage for the runs
+	TArray<FLeaderboardRun> Runs;
+
+	//get the number of runs to return
+	const int32 NumRuns = FMath::Clamp(Count, 0, SortedIndex.Num());
+	Runs.Reserve(NumRuns);
+
+	//iterate through the best runs
+	for (int Index = 0; Index < NumRuns; ++Index)
+	{
+		//add the run
+		Runs.Add(ToRun(Records[SortedIndex[Index].RecordIndex]));
+	}
+
+	//return the runs
+	return Runs;
+}
+
+int32 ULeaderboardSubsystem::GetRankForTime(const double TotalTime) const
+{
+	//return the number of strictly better runs + 1
+	return Algo::LowerBoundBy(SortedIndex, TotalTime, &FLeaderboardIndexEntry::TotalTime) + 1;
+}
+
+bool ULeaderboardSubsystem::GetBestRun(FLeaderboardRun& OutRun) const
+{
+	//check if there are no runs
+	if (SortedIndex.Num() == 0)
+	{
+		return false;
+	}
+
+	//set the best run
+	OutRun = ToRun(Records[SortedIndex[0].RecordIndex]);
+
+	//return that we found a run
+	return true;
+}
+
+FString ULeaderboardSubsystem::GetLeaderboardPath() const
+{
+	//get the name of the map without the play in editor prefix
+	const FString MapName = UWorld::RemovePIEPrefix(GetWorld()->GetMapName());
+
+	//return the path of the leaderboard file
+	return FPaths::ProjectSavedDir() / TEXT("Leaderboards") / MapName + TEXT(".hlb");
+}
+
+void ULeaderboardSubsystem::OnRunFinished(const FRunTimerRecord& Record, bool bIsPersonalBest)
+{
+	//check if the run has no time (e.g. a map without objectives finishing on its first tick)
+	if (Record.TotalTime <= 0)
+	{
+		return;
+	}
+
+	//add the run to the leaderboard
+	SubmitRun(Record);
+}
+
+void ULeaderboardSubsystem::LoadLeaderboard()
+{
+	//clear the leaderboard
+	Records.Reset();
+	SortedIndex.Reset();
+
+	//get the platform file
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	//check if there is no leaderboard file yet
+	if (!PlatformFile.FileExists(*LeaderboardPath))
+	{
+		return;
+	}
+
+	//storage for the file when it can't be mapped
+	TArray<uint8> FileData;
+
+	//map the file (falls back to reading it when mapping isn't supported)
+	TUniquePtr<IMappedFileHandle> MappedHandle(PlatformFile.OpenMapped(*LeaderboardPath));
+	TUniquePtr<IMappedFileRegion> MappedRegion(MappedHandle ? MappedHandle->MapRegion() : nullptr);
+
+	//get the data of the file
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+
+	//check if the file was mapped
+	if (MappedRegion)
+	{
+		Data = MappedRegion->GetMappedPtr();
+		Size = MappedRegion->GetMappedSize();
+	}
+	else if (FFileHelper::LoadFileToArray(FileData, *LeaderboardPath))
+	{
+		Data = FileData.GetData();
+		Size = FileData.Num();
+	}
+
+	//check if the file is too small to have a valid header
+	if (!Data || Size < static_cast<int64>(sizeof(FLeaderboardFileHeader)))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Leaderboard: %s is missing its header, ignoring it"), *LeaderboardPath);
+		return;
+	}
+
+	//get the header and check if it matches the current layout
+	FLeaderboardFileHeader Header;
+	FMemory::Memcpy(&Header, Data, sizeof(Header));
+	const FLeaderboardFileHeader Expected;
+	if (Header.Magic != Expected.Magic || Header.Version != Expected.Version || Header.RecordSize != Expected.RecordSize)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Leaderboard: %s has an unknown format, ignoring it"), *LeaderboardPath);
+		return;
+	}
+
+	//get the number of complete records (a partially written record at the end is ignored)
+	const int32 NumRecords = static_cast<int32>((Size - sizeof(FLeaderboardFileHeader)) / sizeof(FLeaderboardFileRecord));
+
+	//copy the records out of the file in one go
+	Records.SetNumUninitialized(NumRecords);
+	FMemory::Memcpy(Records.GetData(), Data + sizeof(FLeaderboardFileHeader), NumRecords * sizeof(FLeaderboardFileRecord));
+
+	//build the sorted index
+	SortedIndex.Reserve(NumRecords);
+	for (int Index = 0; Index < NumRecords; ++Index)
+	{
+		SortedIndex.Add({ Records[Index].TotalTime, Index });
+	}
+	SortedIndex.Sort([](const FLeaderboardIndexEntry& A, const FLeaderboardIndexEntry& B) { return A.TotalTime < B.TotalTime; });
+
+	//get the size of the file without the partially written record
+	const int64 ValidSize = sizeof(FLeaderboardFileHeader) + static_cast<int64>(NumRecords) * sizeof(FLeaderboardFileRecord);
+
+	//check if the file ends with a partially written record
+	if (Size > ValidSize)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Leaderboard: %s ends with a partial record, truncating it"), *LeaderboardPath);
+
+		//release the file before writing to it
+		MappedRegion.Reset();
+		MappedHandle.Reset();
+
+		//cut off the partial record so the next record is written aligned
+		if (const TUniquePtr<IFileHandle> Handle(PlatformFile.OpenWrite(*LeaderboardPath, true)); !Handle || !Handle->Truncate(ValidSize))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Leaderboard: failed to truncate %s"), *LeaderboardPath);
+		}
+	}
+}
+
+void ULeaderboardSubsystem::AddRecord(const FLeaderboardFileRecord& Record)
+{
+	//add the record
+	const int32 RecordIndex = Records.Add(Record);
+
+	//insert the run time after every equal or better time (so earlier runs keep their rank on ties)
+	const int32 InsertIndex = Algo::UpperBoundBy(SortedIndex, Record.TotalTime, &FLeaderboardIndexEntry::TotalTime);
+	SortedIndex.Insert({ Record.TotalTime, RecordIndex }, InsertIndex);
+}
+
+FLeaderboardRun ULeaderboardSubsystem::ToRun(const FLeaderboardFileRecord& Record)
+{
+	//create the run from the record
+	FLeaderboardRun Run;
+	Run.TotalTime = Record.TotalTime;
+	Run.Date = FDateTime(Record.DateTicks);
+	Run.GhostId = Record.GhostId;
+	Run.Splits.Append(Record.Splits, FMath::Clamp(Record.NumSplits, 0, FLeaderboardFileRecord::MaxSplits));
+
+	//return the run
+	return Run;
+}
@@ -0,0 +1,98 @@
+#include "Core/ObjectiveRegistrySubsystem.h"
+
+#include "Core/RunTimerSubsystem.h"
+
+void UObjectiveRegistrySubsystem::RegisterObjective(AActor* Objective, const FName ObjectiveType)
+{
+	//check if the objective is invalid or already registered
+	if (!Objective || Objectives.Contains(Objective))
+	{
+		return;
+	}
+
+	//add the objective
+	Objectives.Add(Objective, { ObjectiveType, false });
+
+	//broadcast the new counts
+	BroadcastCounts();
+}
+
+void UObjectiveRegistrySubsystem::UnregisterObjective(AActor* Objective)
+{
+	//check if the objective isn't registered
+	FRegisteredObjective Registered;
+	if (!Objective || !Objectives.RemoveAndCopyValue(Objective, Registered))
+	{
+		return;
+	}
+
+	//check if the objective was completed
+	if (Registered.bCompleted)
+	{
+		//remove the completion of the objective
+		Completions.RemoveAll([Objective](const FObjectiveCompletion& Completion) { return Completion.Objective == Objective; });
+	}
+
+	//broadcast the new counts
+	BroadcastCounts();
+}
+
+bool UObjectiveRegistrySubsystem::CompleteObjective(AActor* Objective)
+{
+	//get the registered objective
+	FRegisteredObjective* Registered = Objectives.Find(Objective);
+
+	//check if the objective isn't registered or is already complete
+	if (!Registered || Registered->bCompleted)
+	{
+		return false;
+	}
+
+	//set the objective as completed
+	Registered->bCompleted = true;
+
+	//make the completion
+	FObjectiveCompletion Completion;
+	Completion.Objective = Objective;
+	Completion.ObjectiveType = Registered->ObjectiveType;
+	Completion.WorldTime = GetWorld()->GetTimeSeconds();
+
+	//check if we have a run timer
+	if (URunTimerSubsystem* RunTimer = GetWorld()->GetSubsystem<URunTimerSubsystem>())
+	{
+		//record the split for the objective
+		Completion.SplitIndex = RunTimer->RecordSplit();
+		Completion.RunTime = RunTimer->GetElapsedTime();
+	}
+
+	//add the completion
+	Completions.Add(Completion);
+
+	//broadcast the completion and the new counts
+	OnObjectiveCompleted.Broadcast(Completion);
+	BroadcastCounts();
+
+	return true;
+}
+
+void UObjectiveRegistrySubsystem::ResetObjectives()
+{
+	//set every objective back to active
+	for (TPair<TObjectKey<AActor>, FRegisteredObjective>& Pair : Objectives)
+	{
+		Pair.Value.bCompleted = false;
+	}
+
+	//clear the completions
+	Completions.Reset();
+
+	//broadcast the reset and the new counts
+	OnObjectivesReset.Broadcast();
+	BroadcastCounts();
+}
+
+void UObjectiveRegistrySubsystem::BroadcastCounts()
+{
+	//broadcast the number of active and total objectives
+	OnObjectiveCountChanged.Broadcast(GetNumActiveObjectives(), GetNumObjectives());
+}
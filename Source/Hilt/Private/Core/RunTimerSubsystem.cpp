@@ -0,0 +1,148 @@
+#include "Core/RunTimerSubsystem.h"
+
+void URunTimerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	//call the parent implementation
+	Super::Initialize(Collection);
+
+	//allocate the history up front so finishing a run never grows it
+	History.SetNum(HistoryCapacity);
+}
+
+void URunTimerSubsystem::StartRun()
+{
+	//clear the current run
+	CurrentSplits.Reset();
+	AccumulatedTime = 0;
+
+	//start running from now
+	StartTime = GetNow();
+	bIsRunning = true;
+}
+
+void URunTimerSubsystem::PauseRun()
+{
+	//check if we're not running
+	if (!bIsRunning)
+	{
+		return;
+	}
+
+	//accumulate the time since we started or resumed
+	AccumulatedTime += GetNow() - StartTime;
+	bIsRunning = false;
+}
+
+void URunTimerSubsystem::ResumeRun()
+{
+	//check if we're already running
+	if (bIsRunning)
+	{
+		return;
+	}
+
+	//start running from now
+	StartTime = GetNow();
+	bIsRunning = true;
+}
+
+void URunTimerSubsystem::ResetRun()
+{
+	//clear the current run without changing whether or not it's running
+	CurrentSplits.Reset();
+	AccumulatedTime = 0;
+	StartTime = GetNow();
+}
+
+int32 URunTimerSubsystem::RecordSplit()
+{
+	//add the split
+	const double SplitTime = GetElapsedTime();
+	const int32 SplitIndex = CurrentSplits.Add(SplitTime);
+
+	//call the OnRunSplit event
+	OnRunSplit.Broadcast(SplitIndex, SplitTime, GetSplitDeltaToBest(SplitIndex));
+
+	//return the index of the split
+	return SplitIndex;
+}
+
+void URunTimerSubsystem::FinishRun()
+{
+	//stop the run
+	PauseRun();
+
+	//create the record of the run
+	FRunTimerRecord Record;
+	Record.TotalTime = AccumulatedTime;
+	Record.Splits = CurrentSplits;
+
+	//check if the history is valid
+	if (History.Num() > 0)
+	{
+		//write the record over the oldest run in the history
+		History[HistoryHead] = Record;
+		HistoryHead = (HistoryHead + 1) % History.Num();
+		HistoryNum = FMath::Min(HistoryNum + 1, History.Num());
+	}
+
+	//check if this is a new personal best
+	const bool bIsPersonalBest = !bHasPersonalBest || Record.TotalTime < PersonalBest.TotalTime;
+
+	//check if we should update the personal best
+	if (bIsPersonalBest)
+	{
+		SetPersonalBest(Record);
+	}
+
+	//call the OnRunFinished event
+	OnRunFinished.Broadcast(Record, bIsPersonalBest);
+}
+
+double URunTimerSubsystem::GetElapsedTime() const
+{
+	//return the accumulated time plus the time since we started or resumed (if running)
+	return AccumulatedTime + (bIsRunning ? GetNow() - StartTime : 0);
+}
+
+double URunTimerSubsystem::GetSplitDeltaToBest(const int32 SplitIndex) const
+{
+	//check if we can't compare the split to the personal best
+	if (!bHasPersonalBest || !CurrentSplits.IsValidIndex(SplitIndex) || !PersonalBest.Splits.IsValidIndex(SplitIndex))
+	{
+		return 0;
+	}
+
+	//return the difference between the splits
+	return CurrentSplits[SplitIndex] - PersonalBest.Splits[SplitIndex];
+}
+
+void URunTimerSubsystem::SetPersonalBest(const FRunTimerRecord& Record)
+{
+	//set the personal best
+	PersonalBest = Record;
+	bHasPersonalBest = true;
+}
+
+TArray<FRunTimerRecord> URunTimerSubsystem::GetHistory() const
+{
+	//storage for the runs
+	TArray<FRunTimerRecord> Runs;
+	Runs.Reserve(HistoryNum);
+
+	//iterate backwards from the newest run
+	for (int Index = 1; Index <= HistoryNum; ++Index)
+	{
+		//add the run
+		Runs.Add(History[(HistoryHead - Index + History.Num()) % History.Num()]);
+	}
+
+	//return the runs
+	return Runs;
+}
+
+double URunTimerSubsystem::GetNow() const
+{
+	//return the world time (double precision, stops when paused)
+	return GetWorld() ? GetWorld()->GetTimeSeconds() : 0;
+}
@@ -0,0 +1,348 @@
+#include "Core/StreamingManagerSubsystem.h"
+
+#include "Engine/LevelBounds.h"
+#include "Engine/LevelStreaming.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/PackageName.h"
+
+UStreamingManagerSubsystem::UStreamingManagerSubsystem()
+{
+}
+
+void UStreamingManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	//call the parent implementation
+	Super::Initialize(Collection);
+
+	//cache the bounds of the levels when they're added to the world
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UStreamingManagerSubsystem::OnLevelAddedToWorld);
+}
+
+void UStreamingManagerSubsystem::Deinitialize()
+{
+	//unbind from the levels being added to the world
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+
+	//call the parent implementation
+	Super::Deinitialize();
+}
+
+void UStreamingManagerSubsystem::Tick(const float DeltaTime)
+{
+	//call the parent implementation
+	Super::Tick(DeltaTime);
+
+	//check if we have any pending requests
+	if (PendingRequests.Num() > 0)
+	{
+		//get the pending requests in priority order
+		TArray<TPair<FName, FStreamingRequest>> Requests = PendingRequests.Array();
+		Requests.Sort([](const TPair<FName, FStreamingRequest>& A, const TPair<FName, FStreamingRequest>& B)
+		{
+			return A.Value.Priority != B.Value.Priority ? A.Value.Priority > B.Value.Priority : A.Value.Sequence < B.Value.Sequence;
+		});
+
+		//get the number of requests to apply this frame
+		const int32 NumToApply = FMath::Min(Requests.Num(), FMath::Max(1, MaxVisibilityChangesPerFrame));
+
+		//iterate through the requests to apply
+		for (int Index = 0; Index < NumToApply; ++Index)
+		{
+			//check if the level is still valid
+			if (FStreamingLevelEntry* Entry = Levels.Find(Requests[Index].Key); Entry && Entry->Level.IsValid())
+			{
+				//apply the visibility change
+				ApplyVisibility(*Entry, Requests[Index].Value.bVisible);
+			}
+
+			//remove the request
+			PendingRequests.Remove(Requests[Index].Key);
+		}
+	}
+
+	//check if we should predict the levels the player is heading into
+	if (bPredictFromVelocity)
+	{
+		//update the time until the next prediction
+		TimeUntilPrediction -= DeltaTime;
+
+		//check if it's time to predict
+		if (TimeUntilPrediction <= 0)
+		{
+			//reset the time until the next prediction
+			TimeUntilPrediction = PredictionInterval;
+
+			//predict the levels
+			PredictLevels();
+		}
+	}
+}
+
+TStatId UStreamingManagerSubsystem::GetStatId() const
+{
+	return TStatId();
+}
+
+void UStreamingManagerSubsystem::BuildLevelMap()
+{
+	//clear the map (bounds of levels that are still around are kept)
+	TMap<FName, FStreamingLevelEntry> OldLevels = MoveTemp(Levels);
+	Levels.Reset();
+	Aliases.Reset();
+
+	//get the world's streaming levels
+	const TArray<ULevelStreaming*>& StreamingLevels = GetWorld()->GetStreamingLevels();
+
+	//iterate over the streaming levels
+	for (ULevelStreaming* Level : StreamingLevels)
+	{
+		//check if the level is valid
+		if (!Level)
+		{
+			continue;
+		}
+
+		//get the short package name of the level without the play in editor prefix
+		const FName LevelName = *UWorld::RemovePIEPrefix(FPackageName::GetShortName(Level->GetWorldAssetPackageFName()));
+
+		//add the level (keeping its bounds if we already had them)
+		FStreamingLevelEntry& Entry = Levels.Add(LevelName, OldLevels.FindRef(LevelName));
+		Entry.Level = Level;
+	}
+
+	//store the number of streaming levels the map was built from
+	NumBuiltLevels = StreamingLevels.Num();
+}
+
+void UStreamingManagerSubsystem::RequestVisibility(const FName LevelName, const bool bVisible, const int32 Priority)
+{
+	//get the name of the level
+	const FName Key = ResolveLevelName(LevelName);
+
+	//check if there's no level with that name
+	if (Key.IsNone())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StreamingManager: no streaming level matches %s"), *LevelName.ToString());
+		return;
+	}
+
+	//add or replace the request for the level
+	PendingRequests.Add(Key, { bVisible, Priority, NextSequence++ });
+}
+
+void UStreamingManagerSubsystem::RequestShowLevels(const TArray<FName>& LevelNames)
+{
+	//iterate through the level names
+	for (const FName LevelName : LevelNames)
+	{
+		//request the level to be shown
+		RequestVisibility(LevelName, true, ShowPriority);
+	}
+}
+
+void UStreamingManagerSubsystem::RequestHideLevels(const TArray<FName>& LevelNames)
+{
+	//iterate through the level names
+	for (const FName LevelName : LevelNames)
+	{
+		//request the level to be hidden
+		RequestVisibility(LevelName, false, HidePriority);
+	}
+}
+
+void UStreamingManagerSubsystem::ShowAllLevels()
+{
+	//make sure the level map is up to date
+	if (NumBuiltLevels != GetWorld()->GetStreamingLevels().Num())
+	{
+		BuildLevelMap();
+	}
+
+	//clear any pending requests (they would override showing the levels)
+	PendingRequests.Reset();
+
+	//iterate through the levels
+	for (TPair<FName, FStreamingLevelEntry>& Pair : Levels)
+	{
+		//check if the level is valid
+		if (Pair.Value.Level.IsValid())
+		{
+			//show the level
+			ApplyVisibility(Pair.Value, true);
+		}
+	}
+}
+
+void UStreamingManagerSubsystem::GetLevelNames(TArray<FName>& OutVisible, TArray<FName>& OutHidden)
+{
+	//make sure the level map is up to date
+	if (NumBuiltLevels != GetWorld()->GetStreamingLevels().Num())
+	{
+		BuildLevelMap();
+	}
+
+	//iterate through the levels
+	for (const TPair<FName, FStreamingLevelEntry>& Pair : Levels)
+	{
+		//check if the level is valid
+		if (const ULevelStreaming* Level = Pair.Value.Level.Get())
+		{
+			//add the level to the visible or hidden names
+			(Level->GetLevelStreamingState() == ELevelStreamingState::LoadedVisible ? OutVisible : OutHidden).Add(Pair.Key);
+		}
+	}
+}
+
+ULevelStreaming* UStreamingManagerSubsystem::FindLevel(const FName LevelName)
+{
+	//get the name of the level
+	const FName Key = ResolveLevelName(LevelName);
+
+	//return the level (nullptr if there's no level with that name)
+	return Key.IsNone() ? nullptr : Levels[Key].Level.Get();
+}
+
+FName UStreamingManagerSubsystem::ResolveLevelName(const FName LevelName)
+{
+	//make sure the level map is up to date
+	if (NumBuiltLevels != GetWorld()->GetStreamingLevels().Num())
+	{
+		BuildLevelMap();
+	}
+
+	//check if the name is a level name
+	if (Levels.Contains(LevelName))
+	{
+		return LevelName;
+	}
+
+	//check if the name is a known alias
+	if (const FName* Alias = Aliases.Find(LevelName))
+	{
+		return *Alias;
+	}
+
+	//get the name as a string
+	const FString LevelString = LevelName.ToString();
+
+	//iterate through the levels to find one whose package name contains the name (same matching as before the level map)
+	for (const TPair<FName, FStreamingLevelEntry>& Pair : Levels)
+	{
+		//check if the package name contains the name
+		if (Pair.Value.Level.IsValid() && Pair.Value.Level->GetWorldAssetPackageFName().ToString().Contains(LevelString))
+		{
+			//remember the alias and return it
+			return Aliases.Add(LevelName, Pair.Key);
+		}
+	}
+
+	//return that there's no level with that name
+	return NAME_None;
+}
+
+void UStreamingManagerSubsystem::ApplyVisibility(FStreamingLevelEntry& Entry, const bool bVisible) const
+{
+	//get the level
+	ULevelStreaming* Level = Entry.Level.Get();
+
+	//check if we're showing the level
+	if (bVisible)
+	{
+		//make sure the level is loaded
+		Level->SetShouldBeLoaded(true);
+	}
+	else if (bUnloadHiddenLevels)
+	{
+		//unload the level (its bounds were cached when it was added to the world)
+		Level->SetShouldBeLoaded(false);
+	}
+
+	//set whether or not the level should be visible (the engine streams it asynchronously)
+	Level->SetShouldBeVisible(bVisible);
+}
+
+void UStreamingManagerSubsystem::CacheBounds(FStreamingLevelEntry& Entry)
+{
+	//get the level
+	const ULevelStreaming* Level = Entry.Level.Get();
+
+	//check if we already have the bounds or the level isn't loaded
+	if (Entry.bHasBounds || !Level || !Level->GetLoadedLevel())
+	{
+		return;
+	}
+
+	//cache the bounds of the level
+	Entry.Bounds = ALevelBounds::CalculateLevelBounds(Level->GetLoadedLevel());
+	Entry.bHasBounds = Entry.Bounds.IsValid != 0;
+}
+
+void UStreamingManagerSubsystem::PredictLevels()
+{
+	//get the player pawn
+	const APawn* Pawn = UGameplayStatics::GetPlayerPawn(this, 0);
+
+	//check if the pawn is invalid or isn't moving
+	if (!Pawn || Pawn->GetVelocity().IsNearlyZero())
+	{
+		return;
+	}
+
+	//get the player's current and predicted location
+	const FVector Start = Pawn->GetActorLocation();
+	const FVector End = Start + Pawn->GetVelocity() * PredictionTime;
+
+	//iterate through the levels
+	for (TPair<FName, FStreamingLevelEntry>& Pair : Levels)
+	{
+		//get the level
+		ULevelStreaming* Level = Pair.Value.Level.Get();
+
+		//check if the level is invalid
+		if (!Level)
+		{
+			continue;
+		}
+
+		//cache the bounds of the level if it's loaded (in case it was loaded before the level map was built)
+		CacheBounds(Pair.Value);
+
+		//check if the level should already be loaded or we don't know where it is
+		if (Level->ShouldBeLoaded() || !Pair.Value.bHasBounds)
+		{
+			continue;
+		}
+
+		//check if the player's predicted path goes through the level
+		if (FMath::LineBoxIntersection(Pair.Value.Bounds.ExpandBy(PredictionBoundsMargin), Start, End, End - Start))
+		{
+			//load the level without showing it
+			Level->SetShouldBeLoaded(true);
+			++NumPredictedLoads;
+
+			UE_LOG(LogTemp, Verbose, TEXT("StreamingManager: predicted the player is heading into %s, loading it ahead of time"), *Pair.Key.ToString());
+		}
+	}
+}
+
+void UStreamingManagerSubsystem::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	//check if the level isn't part of our world
+	if (World != GetWorld() || !Level)
+	{
+		return;
+	}
+
+	//iterate through the levels
+	for (TPair<FName, FStreamingLevelEntry>& Pair : Levels)
+	{
+		//check if this is the streaming level of the added level
+		if (Pair.Value.Level.IsValid() && Pair.Value.Level->GetLoadedLevel() == Level)
+		{
+			//cache the bounds of the level
+			CacheBounds(Pair.Value);
+			return;
+		}
+	}
+}
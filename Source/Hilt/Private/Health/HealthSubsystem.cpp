@@ -1,7 +1,8 @@
 
 #include "Health/HealthSubsystem.h"
 
-#include "Kismet/GameplayStatics.h"
+#include "Core/ActorTagSubsystem.h"
+#include "Core/HiltTags.h"
 #include "Health/HealthComponent.h"
 #include "Player/PlayerCharacter.h"
 
@@ -14,9 +15,9 @@ void UHealthSubsystem::Tick(float DeltaTime)
 	//call the parent implementation
 	Super::Tick(DeltaTime);
 
-	//get all the actors of the world
+	//get the ECS actors of the world (from the tag index instead of scanning every actor)
 	TArray<AActor*> Actors;
-	UGameplayStatics::GetAllActorsWithTag(this, "ECS", Actors);
+	GetWorld()->GetSubsystem<UActorTagSubsystem>()->GetActorsWithTag(HiltTags::ECSTag, Actors);
 
 	//iterate through all the actors
 	for (AActor* Actor : Actors)
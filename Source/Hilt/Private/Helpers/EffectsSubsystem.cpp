@@ -0,0 +1,273 @@
+#include "Helpers/EffectsSubsystem.h"
+
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/AudioComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+
+UEffectsSubsystem::UEffectsSubsystem()
+{
+}
+
+void UEffectsSubsystem::Tick(const float DeltaTime)
+{
+	//call the parent implementation
+	Super::Tick(DeltaTime);
+
+	//reset the budgets
+	NiagaraSpawnsThisFrame = 0;
+	AudioSpawnsThisFrame = 0;
+
+	//check if there are no deferred effects
+	if (DeferredEffects.Num() == 0)
+	{
+		return;
+	}
+
+	//get the current time
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+
+	//the number of deferred effects still waiting
+	int32 NumWaiting = 0;
+
+	//iterate through the deferred effects (oldest first)
+	for (int Index = 0; Index < DeferredEffects.Num(); ++Index)
+	{
+		//get the effect
+		FDeferredEffect& Effect = DeferredEffects[Index];
+
+		//check if the effect has waited too long
+		if (CurrentTime - Effect.RequestTime > MaxDeferTime)
+		{
+			continue;
+		}
+
+		//check if the effect is a Niagara system
+		if (UNiagaraSystem* System = Effect.System.Get())
+		{
+			//check if there's budget left
+			if (NiagaraSpawnsThisFrame < MaxNiagaraSpawnsPerFrame)
+			{
+				//start the system
+				StartNiagara(System, Effect.Location, Effect.Rotation);
+				++NiagaraSpawnsThisFrame;
+				continue;
+			}
+		}
+		else if (USoundBase* Sound = Effect.Sound.Get())
+		{
+			//check if there's budget left
+			if (AudioSpawnsThisFrame < MaxAudioSpawnsPerFrame)
+			{
+				//start the sound
+				StartSound(Sound, Effect.Location);
+				++AudioSpawnsThisFrame;
+				continue;
+			}
+		}
+		else
+		{
+			//the asset no longer exists
+			continue;
+		}
+
+		//keep the effect waiting (moved down over the effects that were removed)
+		if (NumWaiting != Index)
+		{
+			DeferredEffects[NumWaiting] = MoveTemp(Effect);
+		}
+		++NumWaiting;
+	}
+
+	//remove the effects that were started or dropped
+	DeferredEffects.SetNum(NumWaiting, EAllowShrinking::No);
+}
+
+TStatId UEffectsSubsystem::GetStatId() const
+{
+	return TStatId();
+}
+
+void UEffectsSubsystem::Deinitialize()
+{
+	//clear the pools (the components are destroyed with the world)
+	DeferredEffects.Reset();
+	FreeNiagaraComponents.Reset();
+	FreeAudioComponents.Reset();
+	NiagaraComponents.Reset();
+	AudioComponents.Reset();
+
+	//call the parent implementation
+	Super::Deinitialize();
+}
+
+void UEffectsSubsystem::PlayNiagaraAtLocation(UNiagaraSystem* System, const FVector Location, const FRotator Rotation)
+{
+	//check if the system is invalid or too far away to see
+	if (!System || IsCulled(Location, NiagaraCullDistance))
+	{
+		return;
+	}
+
+	//check if we're out of budget this frame
+	if (NiagaraSpawnsThisFrame >= MaxNiagaraSpawnsPerFrame)
+	{
+		//start the system in a later frame
+		DeferredEffects.Add({ System, nullptr, Location, Rotation, GetWorld()->GetTimeSeconds() });
+		return;
+	}
+
+	//start the system
+	StartNiagara(System, Location, Rotation);
+	++NiagaraSpawnsThisFrame;
+}
+
+void UEffectsSubsystem::PlaySoundAtLocation(USoundBase* Sound, const FVector Location)
+{
+	//check if the sound is invalid or too far away to hear
+	if (!Sound || IsCulled(Location, AudioCullDistance))
+	{
+		return;
+	}
+
+	//check if we're out of budget this frame
+	if (AudioSpawnsThisFrame >= MaxAudioSpawnsPerFrame)
+	{
+		//start the sound in a later frame
+		DeferredEffects.Add({ nullptr, Sound, Location, FRotator::ZeroRotator, GetWorld()->GetTimeSeconds() });
+		return;
+	}
+
+	//start the sound
+	StartSound(Sound, Location);
+	++AudioSpawnsThisFrame;
+}
+
+void UEffectsSubsystem::StartNiagara(UNiagaraSystem* System, const FVector& Location, const FRotator& Rotation)
+{
+	//get the free components of the system
+	TArray<UNiagaraComponent*>& FreeComponents = FreeNiagaraComponents.FindOrAdd(System);
+
+	//take free components until we find one that's still valid
+	while (FreeComponents.Num() > 0)
+	{
+		//get the last free component
+		UNiagaraComponent* Component = FreeComponents.Pop(EAllowShrinking::No);
+
+		//check if the component is still valid
+		if (IsValid(Component))
+		{
+			//move the component and restart it
+			Component->SetWorldLocationAndRotation(Location, Rotation);
+			Component->Activate(true);
+			return;
+		}
+	}
+
+	//spawn a new component (kept after it finishes so it can be reused)
+	UNiagaraComponent* Component = UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), System, Location, Rotation, FVector(1.f), false, true, ENCPoolMethod::None, true);
+
+	//check if the component couldn't be spawned
+	if (!Component)
+	{
+		return;
+	}
+
+	//return the component to the pool when it finishes
+	Component->OnSystemFinished.AddDynamic(this, &UEffectsSubsystem::OnNiagaraFinished);
+	NiagaraComponents.Add(Component);
+}
+
+void UEffectsSubsystem::StartSound(USoundBase* Sound, const FVector& Location)
+{
+	//get the free components of the sound
+	TArray<UAudioComponent*>& FreeComponents = FreeAudioComponents.FindOrAdd(Sound);
+
+	//take free components until we find one that's still valid
+	while (FreeComponents.Num() > 0)
+	{
+		//get the last free component
+		UAudioComponent* Component = FreeComponents.Pop(EAllowShrinking::No);
+
+		//check if the component is still valid
+		if (IsValid(Component))
+		{
+			//move the component and play it again
+			Component->SetWorldLocation(Location);
+			Component->Play();
+			return;
+		}
+	}
+
+	//spawn a new component (kept after it finishes so it can be reused)
+	UAudioComponent* Component = UGameplayStatics::SpawnSoundAtLocation(GetWorld(), Sound, Location, FRotator::ZeroRotator, 1.f, 1.f, 0.f, nullptr, nullptr, false);
+
+	//check if the component couldn't be spawned
+	if (!Component)
+	{
+		return;
+	}
+
+	//return the component to the pool when it finishes
+	Component->OnAudioFinishedNative.AddUObject(this, &UEffectsSubsystem::OnAudioFinished);
+	AudioComponents.Add(Component);
+}
+
+bool UEffectsSubsystem::IsCulled(const FVector& Location, const float CullDistance) const
+{
+	//check if culling is disabled
+	if (CullDistance <= 0)
+	{
+		return false;
+	}
+
+	//get the player controller
+	const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+
+	//check if there's no camera to cull against
+	if (!PlayerController || !PlayerController->PlayerCameraManager)
+	{
+		return false;
+	}
+
+	//return whether or not the location is further than the cull distance from the camera
+	return FVector::DistSquared(PlayerController->PlayerCameraManager->GetCameraLocation(), Location) > FMath::Square(CullDistance);
+}
+
+void UEffectsSubsystem::OnNiagaraFinished(UNiagaraComponent* Component)
+{
+	//get the free components of the component's system
+	TArray<UNiagaraComponent*>& FreeComponents = FreeNiagaraComponents.FindOrAdd(Component->GetAsset());
+
+	//check if the pool is full
+	if (FreeComponents.Num() >= MaxFreeComponentsPerAsset)
+	{
+		//destroy the component
+		NiagaraComponents.RemoveSwap(Component, EAllowShrinking::No);
+		Component->DestroyComponent();
+		return;
+	}
+
+	//return the component to the pool
+	FreeComponents.AddUnique(Component);
+}
+
+void UEffectsSubsystem::OnAudioFinished(UAudioComponent* Component)
+{
+	//get the free components of the component's sound
+	TArray<UAudioComponent*>& FreeComponents = FreeAudioComponents.FindOrAdd(Component->Sound);
+
+	//check if the pool is full
+	if (FreeComponents.Num() >= MaxFreeComponentsPerAsset)
+	{
+		//destroy the component
+		AudioComponents.RemoveSwap(Component, EAllowShrinking::No);
+		Component->DestroyComponent();
+		return;
+	}
+
+	//return the component to the pool
+	FreeComponents.AddUnique(Component);
+}
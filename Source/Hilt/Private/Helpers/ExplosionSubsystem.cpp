@@ -0,0 +1,156 @@
+#include "Helpers/ExplosionSubsystem.h"
+
+#include "Components/PlayerMovementComponent.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/DamageEvents.h"
+#include "Health/HealthComponent.h"
+#include "Player/PlayerCharacter.h"
+
+int32 UExplosionSubsystem::Explode(const FVector& Location, const FExplosionParams& Params, AActor* Instigator)
+{
+	//check if the explosion has no radius
+	if (Params.Radius <= 0)
+	{
+		return 0;
+	}
+
+	//find everything in the explosion (one query)
+	TArray<FOverlapResult> Overlaps;
+	FCollisionObjectQueryParams ObjectParams;
+	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+	ObjectParams.AddObjectTypesToQuery(ECC_PhysicsBody);
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+	GetWorld()->OverlapMultiByObjectType(Overlaps, Location, FQuat::Identity, ObjectParams, FCollisionShape::MakeSphere(Params.Radius), FCollisionQueryParams(SCENE_QUERY_STAT(Explosion), false));
+
+	//struct for damage to apply after the query
+	struct FExplosionDamage
+	{
+		AActor* Actor;
+		UHealthComponent* HealthComponent;
+		float Damage;
+	};
+
+	//storage for the damage to apply and the actors we've already handled (an actor can overlap with multiple components)
+	TArray<FExplosionDamage, TInlineAllocator<16>> Damages;
+	TSet<AActor*, DefaultKeyFuncs<AActor*>, TInlineSetAllocator<16>> HandledActors;
+
+	//iterate through the overlaps
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		//get the component and actor of the overlap
+		UPrimitiveComponent* Component = Overlap.GetComponent();
+		AActor* Actor = Overlap.GetActor();
+
+		//check if the component is simulating physics
+		if (Component && Component->IsSimulatingPhysics())
+		{
+			//get the normalized distance from the explosion to the component
+			const float ComponentDistance = FMath::Clamp(FVector::Dist(Location, Component->GetComponentLocation()) / Params.Radius, 0.f, 1.f);
+
+			//push the component away from the explosion (constant so the falloff curve is the only falloff)
+			Component->AddRadialImpulse(Location, Params.Radius, Params.Impulse * GetFalloff(Params.ImpulseFalloffCurve, ComponentDistance), RIF_Constant, Params.bVelocityChange);
+		}
+
+		//check if the actor is invalid
+		if (!Actor)
+		{
+			continue;
+		}
+
+		//add the actor to the handled actors and check if it was already handled
+		bool bAlreadyHandled = false;
+		HandledActors.Add(Actor, &bAlreadyHandled);
+		if (bAlreadyHandled)
+		{
+			continue;
+		}
+
+		//get the normalized distance from the explosion to the actor
+		const float NormalizedDistance = FMath::Clamp(FVector::Dist(Location, Actor->GetActorLocation()) / Params.Radius, 0.f, 1.f);
+
+		//check if the actor is the player
+		if (const APlayerCharacter* PlayerCharacter = Cast<APlayerCharacter>(Actor))
+		{
+			//get the direction away from the explosion
+			const FVector Direction = (Actor->GetActorLocation() - Location).GetSafeNormal();
+
+			//apply the impulse to the player's movement
+			PlayerCharacter->PlayerMovementComponent->AddImpulse(Direction * Params.Impulse * GetFalloff(Params.ImpulseFalloffCurve, NormalizedDistance), Params.bVelocityChange);
+		}
+
+		//check if we should damage the actor
+		if (Params.Damage > 0 && (Params.bDamageInstigator || Actor != Instigator))
+		{
+			//add the damage to apply
+			Damages.Add({ Actor, Actor->FindComponentByClass<UHealthComponent>(), Params.Damage * GetFalloff(Params.DamageFalloffCurve, NormalizedDistance) });
+		}
+	}
+
+	//get the controller of the instigator for actors that take damage themselves
+	AController* InstigatorController = Instigator ? Instigator->GetInstigatorController() : nullptr;
+
+	//iterate through the damage to apply
+	for (const FExplosionDamage& Damage : Damages)
+	{
+		//check if the actor has a health component
+		if (Damage.HealthComponent)
+		{
+			//check if the actor can take damage
+			if (Damage.HealthComponent->bCanTakeDamage)
+			{
+				//apply the damage (the health subsystem handles actors that run out of health)
+				Damage.HealthComponent->Health -= FMath::RoundToInt(Damage.Damage);
+			}
+		}
+		else if (Damage.Actor->CanBeDamaged())
+		{
+			//apply the damage through the actor (e.g. enemies that track their own health)
+			Damage.Actor->TakeDamage(Damage.Damage, FRadialDamageEvent(), InstigatorController, Instigator);
+		}
+	}
+
+	//return the number of actors affected
+	return HandledActors.Num();
+}
+
+void UExplosionSubsystem::ClearFalloffTables()
+{
+	//clear the tables
+	FalloffTables.Reset();
+}
+
+float UExplosionSubsystem::GetFalloff(const UCurveFloat* Curve, const float NormalizedDistance)
+{
+	//check if there's no curve
+	if (!Curve)
+	{
+		//return the linear falloff
+		return 1.f - NormalizedDistance;
+	}
+
+	//get the table of the curve
+	TArray<float>* Table = FalloffTables.Find(Curve);
+
+	//check if the curve hasn't been baked yet
+	if (!Table)
+	{
+		//get the number of samples (at least 2 so we can interpolate)
+		const int32 NumSamples = FMath::Max(2, FalloffTableResolution);
+
+		//bake the curve
+		Table = &FalloffTables.Add(Curve);
+		Table->SetNumUninitialized(NumSamples);
+		for (int Index = 0; Index < NumSamples; ++Index)
+		{
+			(*Table)[Index] = Curve->GetFloatValue(float(Index) / (NumSamples - 1));
+		}
+	}
+
+	//get the continuous sample index and the lower sample
+	const float Sample = FMath::Clamp(NormalizedDistance, 0.f, 1.f) * (Table->Num() - 1);
+	const int32 Lower = FMath::Min(FMath::FloorToInt(Sample), Table->Num() - 2);
+
+	//interpolate between the lower and upper samples
+	return FMath::Lerp((*Table)[Lower], (*Table)[Lower + 1], Sample - Lower);
+}
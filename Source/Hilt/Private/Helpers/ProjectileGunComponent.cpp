@@ -2,6 +2,7 @@
 
 #include "Components/GrapplingHook/GrapplingComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
+#include "Helpers/ProjectilePoolSubsystem.h"
 #include "NPC/Components/GrappleableComponent.h"
 #include "Player/PlayerCharacter.h"
 
@@ -16,6 +17,13 @@ void UProjectileGunComponent::BeginPlay()
 
 	//cast the owner to a player character
 	PlayerCharacter = Cast<APlayerCharacter>(GetOwner());
+
+	//check if we should prewarm the projectile pool
+	if (bUseProjectilePool && ProjectileClass)
+	{
+		//spawn the projectiles into the pool
+		GetWorld()->GetSubsystem<UProjectilePoolSubsystem>()->Prewarm(ProjectileClass, PoolPrewarmCount);
+	}
 }
 
 void UProjectileGunComponent::SetInitialProjectileSpeed(const FVector Direction, UProjectileMovementComponent* ProjectileMovementComponent)
@@ -35,6 +43,25 @@ void UProjectileGunComponent::SetInitialProjectileSpeed(const FVector Direction,
 
 AActor* UProjectileGunComponent::FireProjectile(const FVector Direction)
 {
+	//check if we should fire a simulated projectile
+	if (bUseSimulatedProjectiles)
+	{
+		//get the location to fire the projectile from
+		const FVector FireLocation = GetOwner()->GetActorLocation() + GetOwner()->GetActorForwardVector() * FVector::Dist(GetComponentLocation(), GetOwner()->GetActorLocation());
+
+		//get the speed of the projectile
+		const float Speed = SimulatedProjectileParams.InitialSpeed + (bAddOwnerVelocity ? GetOwner()->GetVelocity().Size() : 0);
+
+		//fire the simulated projectile
+		GetWorld()->GetSubsystem<USimulatedProjectileSubsystem>()->FireProjectile(this, FireLocation, Direction * Speed, SimulatedProjectileParams);
+
+		//call the OnProjectileFired delegate (there's no projectile actor)
+		OnProjectileFired.Broadcast(nullptr, GetOwner(), Direction);
+
+		//return that there's no projectile actor
+		return nullptr;
+	}
+
 	//check if the projectile class is invalid
 	if (!ProjectileClass->IsValidLowLevel())
 	{
@@ -51,11 +78,17 @@ AActor* UProjectileGunComponent::FireProjectile(const FVector Direction)
 	//get the location to spawn the projectile
 	const FVector SpawnLocation = GetOwner()->GetActorLocation() + GetOwner()->GetActorForwardVector() * FVector::Dist(GetComponentLocation(), GetOwner()->GetActorLocation());
 
-	//spawn the projectile
-	AActor* Projectile = GetWorld()->SpawnActor<AActor>(ProjectileClass, SpawnLocation, GetOwner()->GetActorRotation());
+	//get the projectile from the pool or spawn it
+	AActor* Projectile = bUseProjectilePool ? GetWorld()->GetSubsystem<UProjectilePoolSubsystem>()->AcquireProjectile(ProjectileClass, SpawnLocation, GetOwner()->GetActorRotation(), GetOwner(), this, GetPooledProjectileLifeTime()) : GetWorld()->SpawnActor<AActor>(ProjectileClass, SpawnLocation, GetOwner()->GetActorRotation());
 
-	//bind the projectile's hit event
-	Projectile->OnActorHit.AddDynamic(this, &UProjectileGunComponent::OnProjectileHit);
+	//check if the projectile couldn't be spawned
+	if (!Projectile)
+	{
+		return nullptr;
+	}
+
+	//bind the projectile's hit event (the pool removes the binding when the projectile is released)
+	Projectile->OnActorHit.AddUniqueDynamic(this, &UProjectileGunComponent::OnProjectileHit);
 
 	//check if the projectile has a projectile movement component
 	if (UProjectileMovementComponent* ProjectileMovementComponent = Projectile->FindComponentByClass<UProjectileMovementComponent>())
@@ -92,3 +125,22 @@ void UProjectileGunComponent::OnProjectileHit(AActor* Projectile, AActor* OtherA
 	//call the OnProjectileCollision delegate
 	OnProjectileCollision.Broadcast(Projectile, OtherActor, Hit);
 }
+
+void UProjectileGunComponent::OnSimulatedProjectileExpired(const FVector& Location, const FRotator& Rotation)
+{
+}
+
+void UProjectileGunComponent::ReleaseProjectile(AActor* Projectile) const
+{
+	//return the projectile to the pool (destroys it if it didn't come from the pool)
+	GetWorld()->GetSubsystem<UProjectilePoolSubsystem>()->ReleaseProjectile(Projectile);
+}
+
+float UProjectileGunComponent::GetPooledProjectileLifeTime() const
+{
+	//get the initial life span of the projectile class (the pool clears the actor's own life span)
+	const float InitialLifeSpan = ProjectileClass ? ProjectileClass->GetDefaultObject<AActor>()->InitialLifeSpan : 0.f;
+
+	//return the initial life span if it's set, otherwise the pooled projectile life time
+	return InitialLifeSpan > 0 ? InitialLifeSpan : PooledProjectileLifeTime;
+}
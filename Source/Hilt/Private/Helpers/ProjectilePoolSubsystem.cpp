@@ -0,0 +1,221 @@
+#include "Helpers/ProjectilePoolSubsystem.h"
+
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "Particles/ParticleSystemComponent.h"
+
+void UProjectilePoolSubsystem::Prewarm(const TSubclassOf<AActor> ProjectileClass, const int32 Count)
+{
+	//check if the projectile class is invalid
+	if (!ProjectileClass)
+	{
+		return;
+	}
+
+	//get the pool of the projectile class
+	FProjectilePool& Pool = Pools.FindOrAdd(ProjectileClass);
+
+	//spawn projectiles until the pool has enough of them
+	while (Pool.FreeActors.Num() < Count)
+	{
+		//spawn the projectile
+		AActor* Projectile = SpawnPooledProjectile(ProjectileClass, FVector::ZeroVector, FRotator::ZeroRotator);
+
+		//check if the projectile couldn't be spawned
+		if (!Projectile)
+		{
+			return;
+		}
+
+		//deactivate the projectile and add it to the pool
+		DeactivateProjectile(Projectile);
+		PooledActors.Add(Projectile, FPooledProjectile());
+		Pool.FreeActors.Add(Projectile);
+	}
+}
+
+AActor* UProjectilePoolSubsystem::AcquireProjectile(const TSubclassOf<AActor> ProjectileClass, const FVector& Location, const FRotator& Rotation, AActor* Owner, UObject* Gun, const float LifeTime)
+{
+	//check if the projectile class is invalid
+	if (!ProjectileClass)
+	{
+		return nullptr;
+	}
+
+	//get the pool of the projectile class
+	FProjectilePool& Pool = Pools.FindOrAdd(ProjectileClass);
+
+	//storage for the projectile
+	AActor* Projectile = nullptr;
+
+	//take projectiles from the pool until we find one that's still valid (projectiles can be destroyed by the level)
+	while (!Projectile && Pool.FreeActors.Num() > 0)
+	{
+		Projectile = Pool.FreeActors.Pop(EAllowShrinking::No);
+		Projectile = IsValid(Projectile) ? Projectile : nullptr;
+	}
+
+	//check if we found a projectile
+	if (Projectile)
+	{
+		//activate the projectile at the location
+		ActivateProjectile(Projectile, Location, Rotation);
+	}
+	else
+	{
+		//spawn a new projectile
+		Projectile = SpawnPooledProjectile(ProjectileClass, Location, Rotation);
+
+		//check if the projectile couldn't be spawned
+		if (!Projectile)
+		{
+			return nullptr;
+		}
+	}
+
+	//set the owner of the projectile
+	Projectile->SetOwner(Owner);
+
+	//mark the projectile as active and store the gun that fired it
+	FPooledProjectile& State = PooledActors.FindOrAdd(Projectile);
+	State.bIsActive = true;
+	State.Gun = Gun;
+
+	//check if the projectile should expire
+	if (LifeTime > 0)
+	{
+		//release the projectile when its life time runs out (the pool replaces the actor's own life span, which would destroy it)
+		TWeakObjectPtr<AActor> WeakProjectile = Projectile;
+		State.ExpiryTimer = GetWorld()->GetSubsystem<UGameplaySchedulerSubsystem>()->SetTimer(this, [this, WeakProjectile]
+		{
+			ReleaseProjectile(WeakProjectile.Get());
+		}, LifeTime);
+	}
+
+	//return the projectile
+	return Projectile;
+}
+
+void UProjectilePoolSubsystem::ReleaseProjectile(AActor* Projectile)
+{
+	//check if the projectile is invalid
+	if (!IsValid(Projectile))
+	{
+		return;
+	}
+
+	//get the state of the projectile (if it came from a pool)
+	FPooledProjectile* State = PooledActors.Find(Projectile);
+
+	//check if the projectile didn't come from a pool
+	if (!State)
+	{
+		//destroy the projectile
+		Projectile->Destroy();
+		return;
+	}
+
+	//check if the projectile was already released
+	if (!State->bIsActive)
+	{
+		return;
+	}
+
+	//stop the projectile from expiring
+	GetWorld()->GetSubsystem<UGameplaySchedulerSubsystem>()->ClearTimer(State->ExpiryTimer);
+
+	//remove the hit bindings of the gun that fired the projectile (so only the gun that fires it next handles its hits)
+	if (UObject* Gun = State->Gun.Get())
+	{
+		Projectile->OnActorHit.RemoveAll(Gun);
+	}
+
+	//deactivate the projectile and return it to its pool
+	State->bIsActive = false;
+	State->Gun.Reset();
+	DeactivateProjectile(Projectile);
+	Pools.FindOrAdd(Projectile->GetClass()).FreeActors.Add(Projectile);
+}
+
+bool UProjectilePoolSubsystem::IsPooled(const AActor* Projectile) const
+{
+	//return whether or not the projectile is in the pooled actors
+	return PooledActors.Contains(Projectile);
+}
+
+void UProjectilePoolSubsystem::DeactivateProjectile(AActor* Projectile)
+{
+	//clear the projectile's life span so it isn't destroyed while it's in the pool
+	Projectile->SetLifeSpan(0);
+
+	//hide the projectile and stop it from colliding and ticking
+	Projectile->SetActorHiddenInGame(true);
+	Projectile->SetActorEnableCollision(false);
+	Projectile->SetActorTickEnabled(false);
+
+	//check if the projectile has a projectile movement component
+	if (UProjectileMovementComponent* ProjectileMovementComponent = Projectile->FindComponentByClass<UProjectileMovementComponent>())
+	{
+		//stop the projectile
+		ProjectileMovementComponent->StopMovementImmediately();
+		ProjectileMovementComponent->Deactivate();
+	}
+
+	//stop the projectile's effects (e.g. trails)
+	TInlineComponentArray<UFXSystemComponent*> FXComponents(Projectile);
+	for (UFXSystemComponent* FXComponent : FXComponents)
+	{
+		FXComponent->DeactivateImmediate();
+	}
+}
+
+void UProjectilePoolSubsystem::ActivateProjectile(AActor* Projectile, const FVector& Location, const FRotator& Rotation)
+{
+	//move the projectile to the location
+	Projectile->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+
+	//show the projectile and let it collide and tick again
+	Projectile->SetActorHiddenInGame(false);
+	Projectile->SetActorEnableCollision(true);
+	Projectile->SetActorTickEnabled(true);
+
+	//check if the projectile has a projectile movement component
+	if (UProjectileMovementComponent* ProjectileMovementComponent = Projectile->FindComponentByClass<UProjectileMovementComponent>())
+	{
+		//check if the movement component stopped simulating (it clears its updated component when it stops)
+		if (!ProjectileMovementComponent->UpdatedComponent)
+		{
+			//move the root component again
+			ProjectileMovementComponent->SetUpdatedComponent(Projectile->GetRootComponent());
+		}
+
+		//restart the movement component
+		ProjectileMovementComponent->Activate(true);
+	}
+
+	//restart the projectile's effects
+	TInlineComponentArray<UFXSystemComponent*> FXComponents(Projectile);
+	for (UFXSystemComponent* FXComponent : FXComponents)
+	{
+		FXComponent->Activate(true);
+	}
+}
+
+AActor* UProjectilePoolSubsystem::SpawnPooledProjectile(const TSubclassOf<AActor> ProjectileClass, const FVector& Location, const FRotator& Rotation)
+{
+	//spawn the projectile even if something is in the way (it's moved before it's used)
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	//spawn the projectile
+	AActor* Projectile = GetWorld()->SpawnActor<AActor>(ProjectileClass, Location, Rotation, SpawnParameters);
+
+	//check if the projectile was spawned
+	if (Projectile)
+	{
+		//clear the projectile's life span (the pool releases the projectile when its life time runs out instead of it being destroyed)
+		Projectile->SetLifeSpan(0);
+	}
+
+	//return the projectile
+	return Projectile;
+}
@@ -0,0 +1,228 @@
+#include "Helpers/SimulatedProjectileSubsystem.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Helpers/ProjectileGunComponent.h"
+
+USimulatedProjectileSubsystem::USimulatedProjectileSubsystem()
+{
+}
+
+void USimulatedProjectileSubsystem::Tick(const float DeltaTime)
+{
+	//call the parent implementation
+	Super::Tick(DeltaTime);
+
+	//check if there are no projectiles
+	if (Locations.Num() == 0)
+	{
+		return;
+	}
+
+	//struct for a projectile that hit something or expired this tick
+	struct FProjectileEvent
+	{
+		TWeakObjectPtr<UProjectileGunComponent> Gun;
+		FHitResult Hit;
+		FVector Location;
+		FVector Velocity;
+		bool bExpired;
+	};
+
+	//storage for the events of this tick (handled after the simulation so the guns can fire new projectiles)
+	TArray<FProjectileEvent, TInlineAllocator<16>> Events;
+
+	//iterate backwards through the projectiles so removed projectiles can be swapped with the last one
+	for (int Index = Locations.Num() - 1; Index >= 0; --Index)
+	{
+		//get the gun of the projectile
+		UProjectileGunComponent* Gun = Guns[Index].Get();
+
+		//apply gravity and get the new location
+		Velocities[Index].Z += GravityZ[Index] * DeltaTime;
+		const FVector NewLocation = Locations[Index] + Velocities[Index] * DeltaTime;
+
+		//get the collision query params (ignoring the owner of the gun)
+		const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SimulatedProjectile), false, Gun && Gun->bIgnoreOwnerCollisions ? Gun->GetOwner() : nullptr);
+
+		//sweep along the path of the projectile
+		FHitResult Hit;
+		const bool bHit = Radii[Index] > 0
+			? GetWorld()->SweepSingleByChannel(Hit, Locations[Index], NewLocation, FQuat::Identity, TraceChannels[Index], FCollisionShape::MakeSphere(Radii[Index]), QueryParams)
+			: GetWorld()->LineTraceSingleByChannel(Hit, Locations[Index], NewLocation, TraceChannels[Index], QueryParams);
+
+		//update the location and remaining lifetime
+		Locations[Index] = bHit ? Hit.Location : NewLocation;
+		RemainingLifeTimes[Index] -= DeltaTime;
+
+		//check if the projectile hit something or expired
+		if (bHit || RemainingLifeTimes[Index] <= 0)
+		{
+			//store the event and remove the projectile
+			Events.Add({ Guns[Index], Hit, Locations[Index], Velocities[Index], !bHit });
+			RemoveProjectile(Index);
+		}
+	}
+
+	//update the instances
+	UpdateInstances();
+
+	//iterate through the events
+	for (const FProjectileEvent& Event : Events)
+	{
+		//check if the gun is no longer valid
+		UProjectileGunComponent* Gun = Event.Gun.Get();
+		if (!Gun)
+		{
+			continue;
+		}
+
+		//check if the projectile expired
+		if (Event.bExpired)
+		{
+			//call the gun's expired function
+			Gun->OnSimulatedProjectileExpired(Event.Location, Event.Velocity.Rotation());
+		}
+		else
+		{
+			//call the gun's hit function (there's no projectile actor)
+			Gun->OnProjectileHit(nullptr, Event.Hit.GetActor(), FVector::ZeroVector, Event.Hit);
+		}
+	}
+}
+
+TStatId USimulatedProjectileSubsystem::GetStatId() const
+{
+	return TStatId();
+}
+
+void USimulatedProjectileSubsystem::FireProjectile(UProjectileGunComponent* Gun, const FVector& Location, const FVector& Velocity, const FSimulatedProjectileParams& Params)
+{
+	//add the projectile
+	Locations.Add(Location);
+	Velocities.Add(Velocity);
+	GravityZ.Add(GetWorld()->GetGravityZ() * Params.GravityScale);
+	RemainingLifeTimes.Add(Params.LifeTime);
+	Radii.Add(Params.Radius);
+	TraceChannels.Add(Params.TraceChannel);
+	MeshIndices.Add(GetMeshIndex(Params.Mesh));
+	MeshScales.Add(Params.MeshScale);
+	Guns.Add(Gun);
+
+	//update the instances so the projectile is drawn this frame
+	UpdateInstances();
+}
+
+void USimulatedProjectileSubsystem::ClearProjectiles()
+{
+	//clear every projectile
+	Locations.Reset();
+	Velocities.Reset();
+	GravityZ.Reset();
+	RemainingLifeTimes.Reset();
+	Radii.Reset();
+	TraceChannels.Reset();
+	MeshIndices.Reset();
+	MeshScales.Reset();
+	Guns.Reset();
+
+	//update the instances
+	UpdateInstances();
+}
+
+void USimulatedProjectileSubsystem::RemoveProjectile(const int32 Index)
+{
+	//remove the projectile from every array
+	Locations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	GravityZ.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	RemainingLifeTimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Radii.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TraceChannels.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	MeshIndices.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	MeshScales.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Guns.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+int32 USimulatedProjectileSubsystem::GetMeshIndex(UStaticMesh* Mesh)
+{
+	//check if there's no mesh
+	if (!Mesh)
+	{
+		return INDEX_NONE;
+	}
+
+	//check if we already have a component for the mesh
+	const int32 ExistingIndex = InstanceComponents.IndexOfByPredicate([Mesh](const UInstancedStaticMeshComponent* Component) { return Component && Component->GetStaticMesh() == Mesh; });
+	if (ExistingIndex != INDEX_NONE)
+	{
+		return ExistingIndex;
+	}
+
+	//check if we need to spawn the actor holding the components
+	if (!InstanceActor)
+	{
+		//spawn the actor
+		InstanceActor = GetWorld()->SpawnActor<AActor>();
+		InstanceActor->SetRootComponent(NewObject<USceneComponent>(InstanceActor));
+		InstanceActor->GetRootComponent()->RegisterComponent();
+	}
+
+	//create the instanced mesh component (drawn only, the projectiles do their own collision)
+	UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(InstanceActor);
+	Component->SetStaticMesh(Mesh);
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->SetMobility(EComponentMobility::Movable);
+	Component->SetupAttachment(InstanceActor->GetRootComponent());
+	Component->RegisterComponent();
+
+	//add the component and its transforms
+	InstanceTransforms.AddDefaulted();
+	return InstanceComponents.Add(Component);
+}
+
+void USimulatedProjectileSubsystem::UpdateInstances()
+{
+	//clear the transforms of every mesh
+	for (TArray<FTransform>& Transforms : InstanceTransforms)
+	{
+		Transforms.Reset();
+	}
+
+	//iterate through the projectiles
+	for (int Index = 0; Index < Locations.Num(); ++Index)
+	{
+		//check if the projectile has a mesh
+		if (InstanceTransforms.IsValidIndex(MeshIndices[Index]))
+		{
+			//add the transform of the projectile
+			InstanceTransforms[MeshIndices[Index]].Emplace(Velocities[Index].Rotation(), Locations[Index], MeshScales[Index]);
+		}
+	}
+
+	//iterate through the instanced mesh components
+	for (int Index = 0; Index < InstanceComponents.Num(); ++Index)
+	{
+		//get the component and its transforms
+		UInstancedStaticMeshComponent* Component = InstanceComponents[Index];
+		const TArray<FTransform>& Transforms = InstanceTransforms[Index];
+
+		//check if the component is invalid
+		if (!Component)
+		{
+			continue;
+		}
+
+		//check if the number of instances changed
+		if (Component->GetInstanceCount() != Transforms.Num())
+		{
+			//replace the instances
+			Component->ClearInstances();
+			Component->AddInstances(Transforms, false, true);
+		}
+		else if (Transforms.Num() > 0)
+		{
+			//move the instances
+			Component->BatchUpdateInstancesTransforms(0, Transforms, true, true, true);
+		}
+	}
+}
@@ -1,6 +1,8 @@
 // Class Includes
 #include "InteractableObjects/BaseInteractableObject.h"
 #include "Core/HiltTags.h"
+#include "Helpers/EffectsSubsystem.h"
+#include "Core/ActorTagSubsystem.h"
 
 // Other Includes
 #include "NiagaraComponent.h"
@@ -12,7 +14,8 @@
 
 ABaseInteractableObject::ABaseInteractableObject()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// Interactables don't tick, the VFX is the root component so it already moves with the object
+	PrimaryActorTick.bCanEverTick = false;
 
 	// Niagara Component -------
 	// Also acts as object 
@@ -49,15 +52,15 @@ void ABaseInteractableObject::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Add Tags
-	Tags.Add(HiltTags::ObjectTag);
-	Tags.Add(HiltTags::ObjectActiveTag);
+	// Add Tags (through the tag index so the tag checks below are set lookups)
+	UActorTagSubsystem* TagSubsystem = GetWorld()->GetSubsystem<UActorTagSubsystem>();
+	TagSubsystem->AddTag(this, HiltTags::ObjectTag);
+	TagSubsystem->AddTag(this, HiltTags::ObjectActiveTag);
 }
 
 void ABaseInteractableObject::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
-	UpdateVFXLocationRotation();
 }
 
 void ABaseInteractableObject::RemoveLevelPresence()
@@ -102,7 +105,7 @@ void ABaseInteractableObject::AddLevelPresence()
 
 bool ABaseInteractableObject::IsActive()
 {
-	return Tags.Contains(HiltTags::ObjectActiveTag) ? true : false;
+	return GetWorld()->GetSubsystem<UActorTagSubsystem>()->HasTag(this, HiltTags::ObjectActiveTag);
 }
 
 void ABaseInteractableObject::UpdateVFXLocationRotation()
@@ -119,16 +122,8 @@ void ABaseInteractableObject::PlayVFX(UNiagaraSystem* _niagaraVFX, FVector _loca
 	if (_niagaraVFX && NiagaraComp) {
 		NiagaraComp->SetAsset(_niagaraVFX);
 
-		NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			this,
-			_niagaraVFX,
-			_location,
-			_rotation,
-			FVector(1.f),
-			true,
-			true,
-			ENCPoolMethod::None,
-			true);
+		// One shot comes from the shared pool, NiagaraComp stays this object's VFX
+		GetWorld()->GetSubsystem<UEffectsSubsystem>()->PlayNiagaraAtLocation(_niagaraVFX, _location, _rotation);
 	}
 }
 
@@ -136,24 +131,24 @@ void ABaseInteractableObject::PlayAudio(USoundBase* _soundBase, FVector _locatio
 {
 	if (_soundBase)
 	{
-		UGameplayStatics::PlaySoundAtLocation(
-			this,
-			_soundBase,
-			_location
-		);
+		GetWorld()->GetSubsystem<UEffectsSubsystem>()->PlaySoundAtLocation(_soundBase, _location);
 	}
 }
 
 void ABaseInteractableObject::ToggleActiveOrInactiveTag()
 {
-	if(Tags.Contains(HiltTags::ObjectActiveTag) && !Tags.Contains(HiltTags::ObjectNotActiveTag))
+	UActorTagSubsystem* TagSubsystem = GetWorld()->GetSubsystem<UActorTagSubsystem>();
+	const bool bHasActiveTag = TagSubsystem->HasTag(this, HiltTags::ObjectActiveTag);
+	const bool bHasNotActiveTag = TagSubsystem->HasTag(this, HiltTags::ObjectNotActiveTag);
+
+	if(bHasActiveTag && !bHasNotActiveTag)
 	{
-		Tags.Remove(HiltTags::ObjectActiveTag);
-		Tags.Add(HiltTags::ObjectNotActiveTag);
-	} else if (!Tags.Contains(HiltTags::ObjectActiveTag) && Tags.Contains(HiltTags::ObjectNotActiveTag))
+		TagSubsystem->RemoveTag(this, HiltTags::ObjectActiveTag);
+		TagSubsystem->AddTag(this, HiltTags::ObjectNotActiveTag);
+	} else if (!bHasActiveTag && bHasNotActiveTag)
 	{
-		Tags.Add(HiltTags::ObjectActiveTag);
-		Tags.Remove(HiltTags::ObjectNotActiveTag);
+		TagSubsystem->AddTag(this, HiltTags::ObjectActiveTag);
+		TagSubsystem->RemoveTag(this, HiltTags::ObjectNotActiveTag);
 	} else
 	{
 		GEngine->AddOnScreenDebugMessage(1, 10.f, FColor::Red, TEXT("Error: Duplicate active/inactive tags detected on object"));
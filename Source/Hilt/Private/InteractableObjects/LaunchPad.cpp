@@ -5,11 +5,13 @@
 #include "Player/PlayerCharacter.h"
 #include "Components/PlayerMovementComponent.h"
 #include "Components/BoxComponent.h"
+#include "Kismet/GameplayStatics.h"
 
 // ---------------------- Constructor`s -----------------------------
 ALaunchPad::ALaunchPad()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// Launch pads don't move and throw from their overlap event
+	PrimaryActorTick.bCanEverTick = false;
 
 	// Trigger Collision Mesh  -------------
 	TriggerCollisionBox = CreateDefaultSubobject<UBoxComponent>(TEXT("TriggerCollisionBox"));
@@ -25,10 +27,21 @@ ALaunchPad::ALaunchPad()
 
 // ---------------------- Public Function`s -------------------------
 
+void ALaunchPad::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+
+	// Bake in the editor so the profile can be previewed
+	BakeLaunchProfile();
+}
+
 void ALaunchPad::BeginPlay()
 {
 	Super::BeginPlay();
 	TriggerCollisionBox->OnComponentBeginOverlap.AddDynamic(this, &ALaunchPad::OnOverlap);
+
+	// Bake against the loaded level
+	BakeLaunchProfile();
 }
 
 void ALaunchPad::Tick(float DeltaTime)
@@ -51,7 +64,7 @@ void ALaunchPad::AddLevelPresence()
 	Super::AddLevelPresence();
 
 	// Reset cooldown
-	GetWorld()->GetTimerManager().ClearTimer(MainTimerHandler);
+	GetWorld()->GetSubsystem<UGameplaySchedulerSubsystem>()->ClearTimer(MainTimerHandler);
 	CooldownComplete();
 
 	// Trigger Collision Box ------------
@@ -62,26 +75,27 @@ void ALaunchPad::AddLevelPresence()
 void ALaunchPad::ResetCooldown()
 {
 	// Reset cooldown
-	GetWorld()->GetTimerManager().ClearTimer(MainTimerHandler);
+	GetWorld()->GetSubsystem<UGameplaySchedulerSubsystem>()->ClearTimer(MainTimerHandler);
 	CooldownComplete();
 }
 
 void ALaunchPad::OnOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
                            UPrimitiveComponent* OtherComponent, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
-	if (CoolingDown == false)
+	// Only the player is thrown, so nothing else starts the cooldown
+	if (CoolingDown == false && Cast<APlayerCharacter>(OtherActor))
 	{
 		ThrowActor(OtherActor);
 		// Sets jumped bool so that function does not repeat.
 		CoolingDown = true;
 		// Resets Jumped to false when x seconds has gone. 
-		GetWorldTimerManager().SetTimer(MainTimerHandler, this, &ALaunchPad::CooldownComplete, LaunchPadCoolDownTime);
+		MainTimerHandler = GetWorld()->GetSubsystem<UGameplaySchedulerSubsystem>()->SetTimer(this, &ALaunchPad::CooldownComplete, LaunchPadCoolDownTime);
 	}
 }
 
 // --------------------- Private Function`s -------------------------
 
-FVector ALaunchPad::CalcThrowDirection()
+FVector ALaunchPad::CalcThrowDirection() const
 {
 	FRotator ActorRotation = GetActorRotation();
 	return ActorRotation.RotateVector(RelativeThrowDirection);
@@ -93,12 +107,39 @@ void ALaunchPad::ThrowActor(AActor* _actor)
 	{
 		APlayerCharacter* Player = Cast<APlayerCharacter>(_actor);
 		if (Player)
-			Player->PlayerMovementComponent->AddImpulse(CalcThrowDirection() * DefaultThrowStrength, true);
+			Player->PlayerMovementComponent->AddImpulse(LaunchProfile.Impulse, true);
 
 		ThrewAnActor();
 	}
 }
 
+void ALaunchPad::BakeLaunchProfile()
+{
+	// Direction & impulse ------------
+	LaunchProfile.Direction = CalcThrowDirection().GetSafeNormal();
+	LaunchProfile.Impulse = CalcThrowDirection() * DefaultThrowStrength;
+	LaunchProfile.LaunchVelocity = LaunchProfile.Impulse.GetClampedToMaxSize(PredictionMaxLaunchSpeed);
+
+	UWorld* World = GetWorld();
+	if (!World)
+		return;
+
+	// Apex ------------
+	// Analytic, since gravity only acts on Z
+	const FVector Start = TriggerCollisionBox->GetComponentLocation();
+	const float GravityZ = World->GetGravityZ();
+	const float ApexTime = GravityZ < 0.0f ? FMath::Max(0.0f, LaunchProfile.LaunchVelocity.Z / -GravityZ) : 0.0f;
+	LaunchProfile.ApexLocation = Start + LaunchProfile.LaunchVelocity * ApexTime + FVector(0.0f, 0.0f, 0.5f * GravityZ * ApexTime * ApexTime);
+
+	// Landing ------------
+	FPredictProjectilePathParams PathParams(0.0f, Start, LaunchProfile.LaunchVelocity, PredictionMaxTime, ECC_WorldStatic, this);
+	PathParams.SimFrequency = 15.0f;
+	FPredictProjectilePathResult PathResult;
+	LaunchProfile.bHasLanding = UGameplayStatics::PredictProjectilePath(this, PathParams, PathResult);
+	LaunchProfile.LandingLocation = LaunchProfile.bHasLanding ? PathResult.HitResult.Location : PathResult.LastTraceDestination.Location;
+	LaunchProfile.FlightTime = PathResult.LastTraceDestination.Time;
+}
+
 void ALaunchPad::CooldownComplete()
 {
 	CoolingDown = false;
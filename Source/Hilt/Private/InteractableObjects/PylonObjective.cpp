@@ -1,6 +1,7 @@
 // Class Includes
 #include "InteractableObjects/PylonObjective.h"
 #include "Hilt/Public/Core/HiltTags.h"
+#include "Core/ObjectiveRegistrySubsystem.h"
 
 // Other Includes
 #include <Kismet/GameplayStatics.h>
@@ -12,7 +13,7 @@
 // ---------------------- Constructor`s -----------------------------
 APylonObjective::APylonObjective()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 	Tags.Add(HiltTags::ObjectiveTag);
 
 	// Trigger Collision Mesh  -------------
@@ -30,6 +31,19 @@ APylonObjective::APylonObjective()
 
 // ---------------------- Public Function`s -------------------------
 
+void APylonObjective::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	// Registers before any actor begins play so the game mode counts this objective
+	if (UWorld* World = GetWorld())
+		if (UObjectiveRegistrySubsystem* ObjectiveRegistry = World->GetSubsystem<UObjectiveRegistrySubsystem>())
+		{
+			ObjectiveRegistry->RegisterObjective(this, ObjectiveType);
+			ObjectiveRegistry->OnObjectivesReset.AddDynamic(this, &APylonObjective::OnObjectivesReset);
+		}
+}
+
 void APylonObjective::BeginPlay()
 {
 	Super::BeginPlay();
@@ -37,6 +51,17 @@ void APylonObjective::BeginPlay()
 	TriggerCollisionBox->OnComponentBeginOverlap.AddDynamic(this, &APylonObjective::OnOverlap);
 }
 
+void APylonObjective::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UObjectiveRegistrySubsystem* ObjectiveRegistry = GetWorld()->GetSubsystem<UObjectiveRegistrySubsystem>())
+	{
+		ObjectiveRegistry->OnObjectivesReset.RemoveDynamic(this, &APylonObjective::OnObjectivesReset);
+		ObjectiveRegistry->UnregisterObjective(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void APylonObjective::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -73,8 +98,9 @@ void APylonObjective::OnOverlap(UPrimitiveComponent* OverlappedComponent, AActor
 			Player->StopGrapple(0);
 		}
 
-		AHiltGameModeBase* GameMode = Cast<AHiltGameModeBase>(UGameplayStatics::GetGameMode(GetWorld()));
-		GameMode->NumActiveObjectives--;
+		// Completes the objective (records its split and updates the objective counts)
+		if (UObjectiveRegistrySubsystem* ObjectiveRegistry = GetWorld()->GetSubsystem<UObjectiveRegistrySubsystem>())
+			ObjectiveRegistry->CompleteObjective(this);
 
 		RemoveLevelPresence();
 		DisableOnce = false;
@@ -83,6 +109,13 @@ void APylonObjective::OnOverlap(UPrimitiveComponent* OverlappedComponent, AActor
 
 // --------------------- Private Function`s -------------------------
 
+void APylonObjective::OnObjectivesReset()
+{
+	if (!IsActive())
+		AddLevelPresence();
+
+	DisableOnce = true;
+}
 
 
 // ---------------- Getter`s / Setter`s / Adder`s --------------------
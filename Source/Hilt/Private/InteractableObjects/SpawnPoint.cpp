@@ -13,7 +13,7 @@
 
 ASpawnPoint::ASpawnPoint()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 
 	// Visible Mesh --------------
 		// Collision Settings	
@@ -1,10 +1,38 @@
 #include "NPC/Components/GrappleableComponent.h"
 
+#include "Components/GrapplingHook/GrappleTargetSubsystem.h"
+
 UGrappleableComponent::UGrappleableComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
 }
 
+void UGrappleableComponent::BeginPlay()
+{
+	//call the parent implementation
+	Super::BeginPlay();
+
+	//check if we have a grapple target subsystem
+	if (UGrappleTargetSubsystem* GrappleTargetSubsystem = GetWorld()->GetSubsystem<UGrappleTargetSubsystem>())
+	{
+		//add this component to the grapple targets
+		GrappleTargetSubsystem->RegisterTarget(this);
+	}
+}
+
+void UGrappleableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	//check if we have a grapple target subsystem
+	if (UGrappleTargetSubsystem* GrappleTargetSubsystem = GetWorld()->GetSubsystem<UGrappleTargetSubsystem>())
+	{
+		//remove this component from the grapple targets
+		GrappleTargetSubsystem->UnregisterTarget(this);
+	}
+
+	//call the parent implementation
+	Super::EndPlay(EndPlayReason);
+}
+
 void UGrappleableComponent::OnStartGrapple(const FHitResult& HitResult)
 {
 	//get the hit location as relative to this actor
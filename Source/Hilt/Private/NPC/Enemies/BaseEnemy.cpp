@@ -3,6 +3,8 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Core/HiltTags.h"
+#include "Helpers/EffectsSubsystem.h"
+#include "Core/ActorTagSubsystem.h"
 
 // Other Includes
 #include "NiagaraFunctionLibrary.h"
@@ -57,9 +59,10 @@ void ABaseEnemy::BeginPlay()
 	CollisionMesh->OnComponentBeginOverlap.AddDynamic(this, &ABaseEnemy::OnOverlap);
 	CollisionMesh->OnComponentEndOverlap.AddDynamic(this, &ABaseEnemy::EndOverlap);
 
-	// AddTags
-	Tags.Add(HiltTags::EnemyTag);
-	Tags.Add(HiltTags::EnemyAliveTag);
+	// AddTags (through the tag index so the tag checks below are set lookups)
+	UActorTagSubsystem* TagSubsystem = GetWorld()->GetSubsystem<UActorTagSubsystem>();
+	TagSubsystem->AddTag(this, HiltTags::EnemyTag);
+	TagSubsystem->AddTag(this, HiltTags::EnemyAliveTag);
 }
 
 void ABaseEnemy::Tick(float DeltaTime)
@@ -84,7 +87,7 @@ void ABaseEnemy::AddLevelPresence()
 
 bool ABaseEnemy::IsAlive()
 {
-	return Tags.Contains(HiltTags::EnemyAliveTag) ? true : false;
+	return GetWorld()->GetSubsystem<UActorTagSubsystem>()->HasTag(this, HiltTags::EnemyAliveTag);
 }
 
 float ABaseEnemy::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
@@ -127,16 +130,8 @@ void ABaseEnemy::PlayVFX(UNiagaraSystem* _niagaraVFX, FVector _location, FRotato
 	if (_niagaraVFX && NiagaraComp) {
 		NiagaraComp->SetAsset(_niagaraVFX);
 
-		NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			this,
-			_niagaraVFX,
-			_location,
-			_rotation,
-			FVector(1.f),
-			true,
-			true,
-			ENCPoolMethod::None,
-			true);
+		// One shot comes from the shared pool, NiagaraComp stays this enemy's VFX
+		GetWorld()->GetSubsystem<UEffectsSubsystem>()->PlayNiagaraAtLocation(_niagaraVFX, _location, _rotation);
 	}
 }
 
@@ -144,11 +139,7 @@ void ABaseEnemy::PlayAudio(USoundBase* _soundBase, FVector _location)
 {
 	if (_soundBase)
 	{
-		UGameplayStatics::PlaySoundAtLocation(
-			this,
-			_soundBase,
-			_location
-		);
+		GetWorld()->GetSubsystem<UEffectsSubsystem>()->PlaySoundAtLocation(_soundBase, _location);
 	}
 }
 
@@ -156,15 +147,19 @@ void ABaseEnemy::PlayAudio(USoundBase* _soundBase, FVector _location)
 
 void ABaseEnemy::ToggleActiveOrInactiveTag()
 {
-	if (Tags.Contains(HiltTags::EnemyAliveTag) && !Tags.Contains(HiltTags::EnemyDeadTag))
+	UActorTagSubsystem* TagSubsystem = GetWorld()->GetSubsystem<UActorTagSubsystem>();
+	const bool bHasAliveTag = TagSubsystem->HasTag(this, HiltTags::EnemyAliveTag);
+	const bool bHasDeadTag = TagSubsystem->HasTag(this, HiltTags::EnemyDeadTag);
+
+	if (bHasAliveTag && !bHasDeadTag)
 	{
-		Tags.Remove(HiltTags::EnemyAliveTag);
-		Tags.Add(HiltTags::EnemyDeadTag);
+		TagSubsystem->RemoveTag(this, HiltTags::EnemyAliveTag);
+		TagSubsystem->AddTag(this, HiltTags::EnemyDeadTag);
 	}
-	else if (!Tags.Contains(HiltTags::EnemyAliveTag) && Tags.Contains(HiltTags::EnemyDeadTag))
+	else if (!bHasAliveTag && bHasDeadTag)
 	{
-		Tags.Add(HiltTags::EnemyAliveTag);
-		Tags.Remove(HiltTags::EnemyDeadTag);
+		TagSubsystem->AddTag(this, HiltTags::EnemyAliveTag);
+		TagSubsystem->RemoveTag(this, HiltTags::EnemyDeadTag);
 	}
 	else
 	{
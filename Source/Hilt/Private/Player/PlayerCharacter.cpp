@@ -12,6 +12,7 @@
 #include "Components/RocketLauncherComponent.h"
 #include "Components/GrapplingHook/RopeComponent.h"
 #include "Core/HiltGameModeBase.h"
+#include "Core/StreamingManagerSubsystem.h"
 #include "Health/DamageComponent.h"
 #include "Health/HealthComponent.h"
 #include "InventorySystem/InventoryComponent.h"
@@ -107,71 +108,16 @@ void APlayerCharacter::BeginPlay()
 	GameMode = GetWorld()->GetAuthGameMode<AHiltGameModeBase>();
 }
 
-void APlayerCharacter::ShowStreamingLevel(TArray<FName> LevelsToShow)
+void APlayerCharacter::ShowStreamingLevel(const TArray<FName>& LevelsToShow)
 {
-	//check if levels to show is empty
-	if (LevelsToShow.Num() == 0)
-	{
-		//return to prevent further execution
-		return;
-	}
-
-	//get the world's streaming levels
-	TArray<ULevelStreaming*> StreamingLevels = GetWorld()->GetStreamingLevels();
-
-	//iterate over the streaming levels
-	for (ULevelStreaming* Level : StreamingLevels)
-	{
-		//check if the level is valid
-		if (Level)
-		{
-			//iterate over the levels to show
-			for (FName LevelName : LevelsToShow)
-			{
-				//check if the level is in the levels to load array
-				if (Level->GetWorldAssetPackageFName().ToString().Contains(*LevelName.ToString()))
-				{
-					//set the next level to be visible
-					Level->SetShouldBeVisible(true);
-
-					//break the loop
-					break;
-				}
-			}
-		}
-	}
+	//request the levels to be shown by the streaming manager
+	GetWorld()->GetSubsystem<UStreamingManagerSubsystem>()->RequestShowLevels(LevelsToShow);
 }
 
-void APlayerCharacter::HideStreamingLevel(TArray<FName> LevelsToHide)
+void APlayerCharacter::HideStreamingLevel(const TArray<FName>& LevelsToHide)
 {
-	//check if levels to show is empty
-	if (LevelsToHide.Num() == 0)
-	{
-		//return to prevent further execution
-		return;
-	}
-
-	//get the world's streaming levels
-	TArray<ULevelStreaming*> StreamingLevels = GetWorld()->GetStreamingLevels();
-
-	//iterate over the streaming levels
-	for (ULevelStreaming* Level : StreamingLevels)
-	{
-		//check if the level is valid
-		if (Level)
-		{
-			//iterate over the levels to show
-			for (FName LevelName : LevelsToHide)
-			{
-				//check if the level is in the levels to load array
-				if (Level->GetWorldAssetPackageFName().ToString().Contains(*LevelName.ToString()))
-				{
-					//set the next level to be visible
-					Level->SetShouldBeVisible(false);
-				}
-			}
-		}
-	}
+	//request the levels to be hidden by the streaming manager
+	GetWorld()->GetSubsystem<UStreamingManagerSubsystem>()->RequestHideLevels(LevelsToHide);
 }
 
 void APlayerCharacter::WasdMovement(const FInputActionValue& Value)
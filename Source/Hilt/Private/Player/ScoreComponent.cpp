@@ -21,6 +21,12 @@ void UScoreComponent::BeginPlay()
 
 	//get the owner as a player character
 	PlayerCharacter = Cast<APlayerCharacter>(GetOwner());
+
+	//bake the degradation table
+	BakeDegradationTable();
+
+	//set the starting score tier without calling OnScoreTierChanged
+	CurrentScoreTier = FMath::Clamp(FMath::FloorToInt(Score), 0, FMath::Max(ScoreValues.Num() - 1, 0));
 }
 
 void UScoreComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -29,13 +35,10 @@ void UScoreComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActor
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	//check if the score degradation curve is valid and the last score gain time + the score decay delay is less than the current time and that we're not falling and we're walking
-	if (ScoreDegradationCurve && LastScoreGainTime + GetCurrentScoreValues().ScoreDecayDelay < GetWorld()->GetTimeSeconds() && bShouldDegrade)
+	if (bShouldDegrade && DegradationTable.Num() > 0 && LastScoreGainTime + GetCurrentScoreValues().ScoreDecayDelay < GetWorld()->GetTimeSeconds())
 	{
-		//get the degradation value from the curve
-		const float DegradationValue = ScoreDegradationCurve->GetFloatValue(Score / ScoreValues.Num());
-
 		//degrade the score
-		Score -= DegradationValue * DeltaTime;
+		Score -= GetDegradationValue() * DeltaTime;
 
 		//check if the score is less than 0
 		if (Score < 0)
@@ -43,6 +46,9 @@ void UScoreComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActor
 			//set the score to 0
 			Score = 0;
 		}
+
+		//update the score tier
+		UpdateScoreTier();
 	}
 }
 
@@ -54,6 +60,9 @@ void UScoreComponent::AddScore(const float Value)
 	//apply the score addition value
 	Score = FMath::Clamp(Score + Value * GetCurrentScoreValues().ScoreGainMultiplier, 0.f, ScoreValues.Num() - 0.01);
 
+	//update the score tier
+	UpdateScoreTier();
+
 	//set the last score gain time
 	LastScoreGainTime = GetWorld()->GetTimeSeconds();
 
@@ -73,6 +82,9 @@ void UScoreComponent::SubtractScore(const float Value)
 	//apply the score subtraction value
 	Score = FMath::Clamp(Score - Value * GetCurrentScoreValues().ScoreLossMultiplier, 0.f, ScoreValues.Num() - 0.01);
 
+	//update the score tier
+	UpdateScoreTier();
+
 	//set the last score gain time to -infinity
 	LastScoreGainTime = -INFINITY;
 
@@ -87,6 +99,9 @@ void UScoreComponent::SubtractScore(const float Value)
 void UScoreComponent::ResetScore()
 {
 	Score = 0;
+
+	//update the score tier
+	UpdateScoreTier();
 }
 
 void UScoreComponent::StartDegredationTimer()
@@ -108,9 +123,71 @@ void UScoreComponent::StopDegredationTimer()
 	}
 }
 
-FScoreValues UScoreComponent::GetCurrentScoreValues() const
+const FScoreValues& UScoreComponent::GetCurrentScoreValues() const
 {
 	//return the score values at the current score
-	return ScoreValues[FMath::Min(ScoreValues.Num() - 1, FMath::Floor(Score))];
+	return ScoreValues[CurrentScoreTier];
+}
+
+int32 UScoreComponent::GetCurrentScoreTier() const
+{
+	//return the cached score tier
+	return CurrentScoreTier;
+}
+
+void UScoreComponent::BakeDegradationTable()
+{
+	//clear the table
+	DegradationTable.Reset();
+
+	//check if we don't have a degradation curve
+	if (!ScoreDegradationCurve)
+	{
+		return;
+	}
+
+	//get the number of samples (at least 2 so we can interpolate)
+	const int32 NumSamples = FMath::Max(2, DegradationTableResolution);
+
+	//allocate the table
+	DegradationTable.SetNumUninitialized(NumSamples);
+
+	//iterate through all the samples
+	for (int Index = 0; Index < NumSamples; ++Index)
+	{
+		//store the curve value at this sample
+		DegradationTable[Index] = ScoreDegradationCurve->GetFloatValue(float(Index) / (NumSamples - 1));
+	}
+}
+
+float UScoreComponent::GetDegradationValue() const
+{
+	//get the continuous sample index of the current score (same input as the curve)
+	const float Sample = FMath::Clamp(Score / FMath::Max(ScoreValues.Num(), 1), 0.f, 1.f) * (DegradationTable.Num() - 1);
+
+	//get the lower sample (clamped so the upper sample is always in the table)
+	const int32 Lower = FMath::Min(FMath::FloorToInt(Sample), DegradationTable.Num() - 2);
+
+	//interpolate between the lower and upper samples
+	return FMath::Lerp(DegradationTable[Lower], DegradationTable[Lower + 1], Sample - Lower);
+}
+
+void UScoreComponent::UpdateScoreTier()
+{
+	//get the tier of the current score
+	const int32 NewTier = FMath::Clamp(FMath::FloorToInt(Score), 0, FMath::Max(ScoreValues.Num() - 1, 0));
+
+	//check if the tier hasn't changed
+	if (NewTier == CurrentScoreTier)
+	{
+		return;
+	}
+
+	//store the old tier and set the new one
+	const int32 OldTier = CurrentScoreTier;
+	CurrentScoreTier = NewTier;
+
+	//call the OnScoreTierChanged event
+	OnScoreTierChanged.Broadcast(NewTier, OldTier);
 }
 
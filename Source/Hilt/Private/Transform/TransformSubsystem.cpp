@@ -1,7 +1,8 @@
 
 #include "Transform/TransformSubsystem.h"
 
-#include "Kismet/GameplayStatics.h"
+#include "Core/ActorTagSubsystem.h"
+#include "Core/HiltTags.h"
 #include "Transform/TransformComponent.h"
 
 UTransformSubsystem::UTransformSubsystem()
@@ -13,9 +14,9 @@ void UTransformSubsystem::Tick(float DeltaTime)
 	//call the parent implementation
 	Super::Tick(DeltaTime);
 
-	//get all the actors of the world
+	//get the ECS actors of the world (from the tag index instead of scanning every actor)
 	TArray<AActor*> Actors;
-	UGameplayStatics::GetAllActorsWithTag(this, "ECS", Actors);
+	GetWorld()->GetSubsystem<UActorTagSubsystem>()->GetActorsWithTag(HiltTags::ECSTag, Actors);
 
 	//iterate through all the actors
 	for (AActor* Actor : Actors)
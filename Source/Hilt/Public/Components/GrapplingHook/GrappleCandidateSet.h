@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+//struct for a cached set of the primitives near the player that the grapple can hit (used to avoid scene traces when checking where the player is aiming)
+struct FGrappleCandidateSet
+{
+	//the primitives in the set
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> Candidates;
+
+	//the location the set was gathered around
+	FVector Center = FVector::ZeroVector;
+
+	//the radius the set was gathered in
+	float Radius = 0.f;
+
+	//the world time the set was gathered at
+	double RefreshTime = -1.0;
+
+	//whether or not the set can be used (false when it was never gathered or had too many primitives to be cheaper than a trace)
+	bool bIsValid = false;
+
+	//gathers all primitives around the center that block or overlap the given channel (an overlap query, so this is meant to be called at a low frequency)
+	void Refresh(const UWorld* World, const FVector& InCenter, float InRadius, ECollisionChannel Channel, const FCollisionQueryParams& Params, int32 MaxCandidates);
+
+	//how far a ray starting at the given location travels before it leaves the gathered area (0 when the set is invalid or the start is outside the area)
+	float GetExitDistance(const FVector& Start, const FVector& Direction) const;
+
+	//traces a ray against the primitives in the set, returning overlap hits and the closest blocking hit sorted by distance (same layout as a multi line trace)
+	void Raycast(TArray<FHitResult>& OutHits, const FVector& Start, const FVector& End, ECollisionChannel Channel, const FCollisionQueryParams& Params) const;
+
+	//clears the set
+	void Reset();
+};
@@ -0,0 +1,29 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FScoreValues;
+
+//struct for a precomputed table of the grapple pull force multiplier of a score tier (the angle, distance and velocity curves combined into one lookup)
+struct FGrapplePullResponseTable
+{
+	//the number of samples along each axis (x = angle dot product, y = normalized distance, z = normalized pull step)
+	FIntVector Resolution = FIntVector::ZeroValue;
+
+	//the largest normalized pull step (pull speed * delta time / speed limit) stored in the table, larger steps are clamped to it
+	float MaxNormalizedStep = 1.f;
+
+	//the multipliers of the table (x changes fastest)
+	TArray<float> Values;
+
+	//bakes the table from the curves of a score tier
+	void Bake(const FScoreValues& ScoreValues, const FIntVector& InResolution, float InMaxNormalizedStep);
+
+	//gets the pull force multiplier using trilinear interpolation (dot product of the velocity and the grapple direction, rope length / max grapple distance, pull speed * delta time / speed limit)
+	float Sample(float AngleDot, float NormalizedDistance, float NormalizedStep) const;
+
+	//whether or not the table has been baked
+	bool IsValid() const { return !Values.IsEmpty(); }
+};
@@ -0,0 +1,106 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/GrapplingHook/GrapplePullResponse.h"
+#include "Core/Math/InterpShorthand.h"
+#include "GrappleReleaseSolver.generated.h"
+
+//enum for what the grapple release solver should maximize
+UENUM(BlueprintType)
+enum EGrappleReleaseObjective
+{
+	//the horizontal distance travelled by the end of the prediction
+	MaximizeDistance,
+
+	//the speed at the moment of release
+	MaximizeReleaseSpeed,
+};
+
+//struct for the result of the grapple release solver
+USTRUCT(BlueprintType)
+struct FGrappleReleaseResult
+{
+	GENERATED_BODY()
+
+	//whether or not the solver found a release
+	UPROPERTY(BlueprintReadOnly)
+	bool bIsValid = false;
+
+	//how long from when the solver was started to release the grapple (in seconds)
+	UPROPERTY(BlueprintReadOnly)
+	float ReleaseDelay = 0;
+
+	//the predicted location of the player at the release
+	UPROPERTY(BlueprintReadOnly)
+	FVector ReleaseLocation = FVector::ZeroVector;
+
+	//the predicted velocity of the player at the release
+	UPROPERTY(BlueprintReadOnly)
+	FVector ReleaseVelocity = FVector::ZeroVector;
+
+	//the predicted location of the player at the end of the prediction
+	UPROPERTY(BlueprintReadOnly)
+	FVector EndLocation = FVector::ZeroVector;
+
+	//the value of the objective for this release
+	UPROPERTY(BlueprintReadOnly)
+	float Score = 0;
+};
+
+//struct for a snapshot of everything the grapple release solver needs (copied from the game thread so the solve can run on a worker thread)
+struct FGrappleReleaseInput
+{
+	//the anchor of the rope
+	FVector Anchor = FVector::ZeroVector;
+
+	//the current location and velocity of the player
+	FVector Location = FVector::ZeroVector;
+	FVector Velocity = FVector::ZeroVector;
+
+	//whether or not the player is interpolating their velocity (otherwise the pull is added to the velocity)
+	bool bInterpVelocity = false;
+
+	//the pull speed and acceleration of the grapple
+	float PullSpeed = 0;
+	float PullAccel = 0;
+
+	//the interp mode used when interpolating the velocity
+	TEnumAsByte<EInterpToTargetType> InterpMode = InterpTo;
+
+	//the pull force multiplier to use when there's no pull response table
+	float PullMultiplier = 1;
+
+	//the pull response table of the current score tier (optional)
+	FGrapplePullResponseTable PullResponseTable;
+
+	//the max grapple distance (for normalizing the rope length) and the distance at which the grapple stops by itself
+	float MaxGrappleDistance = 9000;
+	float StopDistance = 100;
+
+	//the speed limit and the max speed the velocity is clamped to
+	float SpeedLimit = 1;
+	float MaxSpeed = 1;
+
+	//the gravity while grappling and while falling after the release
+	float GrappleGravityZ = 0;
+	float FallingGravityZ = -980;
+
+	//how far ahead to predict the grapple release (in seconds), how long to predict the fall after it, and the time step of the prediction
+	float PredictionTime = 2;
+	float FallTime = 1;
+	float TimeStep = 1.f / 60.f;
+
+	//how many release times to test
+	int32 NumCandidates = 32;
+
+	//what to maximize
+	TEnumAsByte<EGrappleReleaseObjective> Objective = MaximizeDistance;
+};
+
+namespace GrappleReleaseSolver
+{
+	//simulates every candidate release time in one batch (candidates are stored as arrays of components and stepped together) and returns the best release
+	FGrappleReleaseResult Solve(const FGrappleReleaseInput& Input);
+}
@@ -0,0 +1,102 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GrappleTargetSubsystem.generated.h"
+
+class UGrappleableComponent;
+
+//struct for the parameters of a grapple target query
+USTRUCT(BlueprintType)
+struct FGrappleTargetQuery
+{
+	GENERATED_BODY()
+
+	//the location to search from (usually the camera location)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FVector Origin = FVector::ZeroVector;
+
+	//the direction to search in (usually the camera forward vector)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FVector Direction = FVector::ForwardVector;
+
+	//the max distance a target can be from the origin
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float MaxDistance = 9000;
+
+	//the half angle of the search cone (in degrees)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float ConeHalfAngle = 10;
+
+	//how much the angle to the target matters when ranking the targets
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float AngleWeight = 1;
+
+	//how much the distance to the target matters when ranking the targets
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float DistanceWeight = 0.25f;
+
+	//how many of the best ranked targets to check the visibility of before giving up
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 MaxVisibilityTraces = 1;
+
+	//the collision channel to use for the visibility trace
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility;
+};
+
+UCLASS()
+class UGrappleTargetSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	//the size of each cell of the grid the targets are stored in
+	float CellSize = 2000;
+
+	//how often to move the targets to the grid cell of their current location (in seconds)
+	float RebucketInterval = 0.1f;
+
+	//constructor
+	UGrappleTargetSubsystem();
+
+	//override(s)
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual void Deinitialize() override;
+
+	//function to add a grappleable component to the grid
+	void RegisterTarget(UGrappleableComponent* Target);
+
+	//function to remove a grappleable component from the grid
+	void UnregisterTarget(UGrappleableComponent* Target);
+
+	//function to get the best visible grapple target within the query's cone (returns nullptr if none was found, OutHit is the visibility trace's hit on the target)
+	UGrappleableComponent* FindBestTarget(const FGrappleTargetQuery& Query, const FCollisionQueryParams& Params, FHitResult& OutHit) const;
+
+	//function to get all the targets within the query's cone, ranked from best to worst (no visibility checks)
+	void GetRankedTargets(const FGrappleTargetQuery& Query, TArray<UGrappleableComponent*>& OutTargets) const;
+
+private:
+
+	//the grid cells and the targets in them
+	TMap<FIntVector, TArray<TWeakObjectPtr<UGrappleableComponent>>> Cells;
+
+	//the cell each registered target is in
+	TMap<TWeakObjectPtr<UGrappleableComponent>, FIntVector> TargetCells;
+
+	//the time since the targets were last moved to their current cells
+	float TimeSinceRebucket = 0;
+
+	//function to get the grid cell of a location
+	FIntVector GetCell(const FVector& Location) const;
+
+	//function to remove a target from a cell
+	void RemoveFromCell(const TWeakObjectPtr<UGrappleableComponent>& Target, const FIntVector& Cell);
+
+	//function to move all the targets to the cells of their current locations
+	void Rebucket();
+};
@@ -4,6 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "Core/Math/InterpShorthand.h"
+#include "Components/GrapplingHook/GrappleCandidateSet.h"
+#include "Components/GrapplingHook/GrapplePullResponse.h"
+#include "Components/GrapplingHook/GrappleReleaseSolver.h"
+#include "Components/GrapplingHook/GrappleTargetSubsystem.h"
 #include "GrapplingComponent.generated.h"
 
 //enum for different grappling modes based of player input
@@ -48,6 +52,7 @@ public:
 	//events for the grappling
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStartGrapple, const FHitResult&, HitResult);
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnStopGrapple);
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnReleaseSolved, const FGrappleReleaseResult&, Result);
 
 	//the rope component to use
 	UPROPERTY(BlueprintReadOnly, Category = "Rope")
@@ -65,6 +70,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Events")
 	FOnStopGrapple OnStopGrapple;
 
+	//event called on the game thread when the release solver has finished
+	UPROPERTY(BlueprintAssignable, Category = "Events")
+	FOnReleaseSolved OnReleaseSolved;
+
 	//whether or not we're grappling
 	UPROPERTY(BlueprintReadOnly)
 	bool bIsGrappling = false;
@@ -149,6 +158,74 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CanGrapple")
 	bool CanGrappleVar = false;
 
+	//whether or not to check where the player is aiming against a cached set of primitives near the camera, only tracing the scene for the part of the ray beyond them (the grapple itself always uses a scene trace)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CanGrapple|Candidates")
+	bool bUseGrappleCandidates = true;
+
+	//the radius around the camera to gather primitives in (rays are traced against the set inside it and against the scene beyond it)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CanGrapple|Candidates", meta = (EditCondition = "bUseGrappleCandidates", ClampMin = "0"))
+	float GrappleCandidateRadius = 3000;
+
+	//how often to regather the nearby primitives (in seconds)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CanGrapple|Candidates", meta = (EditCondition = "bUseGrappleCandidates", ClampMin = "0"))
+	float GrappleCandidateRefreshInterval = 0.25f;
+
+	//how far the camera can move from where the set was gathered before it needs to be regathered
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CanGrapple|Candidates", meta = (EditCondition = "bUseGrappleCandidates", ClampMin = "0"))
+	float GrappleCandidateRadiusMargin = 1000;
+
+	//the max number of primitives in the set before it's considered more expensive than a scene trace (0 = no limit)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CanGrapple|Candidates", meta = (EditCondition = "bUseGrappleCandidates", ClampMin = "0"))
+	int32 MaxGrappleCandidates = 512;
+
+	//whether or not to use aim assist to grapple to the best grappleable object near where the player is aiming when they aren't aiming directly at something
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CanGrapple|Aim Assist")
+	bool bUseAimAssist = false;
+
+	//the query to use for finding the aim assist target (the origin, direction, distance and channel are set from the camera and rope)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CanGrapple|Aim Assist", meta = (EditCondition = "bUseAimAssist"))
+	FGrappleTargetQuery AimAssistQuery;
+
+	//the current aim assist target (if any)
+	UPROPERTY(BlueprintReadOnly, Category = "CanGrapple|Aim Assist")
+	class UGrappleableComponent* AimAssistTarget = nullptr;
+
+	//the hit on the current aim assist target
+	UPROPERTY(BlueprintReadOnly, Category = "CanGrapple|Aim Assist")
+	FHitResult AimAssistHit;
+
+	//whether or not to use the precomputed pull response tables instead of evaluating the angle, distance and velocity curves of the score values every tick
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grappling|Pull Response")
+	bool bUsePullResponseTable = false;
+
+	//the number of samples of the pull response tables along each axis (x = angle, y = distance, z = pull step)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grappling|Pull Response", meta = (EditCondition = "bUsePullResponseTable"))
+	FIntVector PullResponseTableResolution = FIntVector(33, 17, 9);
+
+	//the largest pull step (pull speed * delta time / speed limit) the pull response tables cover, larger steps are clamped
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grappling|Pull Response", meta = (EditCondition = "bUsePullResponseTable", ClampMin = "0"))
+	float PullResponseMaxNormalizedStep = 0.25f;
+
+	//how far ahead the release solver should look for a release (in seconds)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grappling|Release Solver", meta = (ClampMin = "0"))
+	float ReleasePredictionTime = 2;
+
+	//how long the release solver should simulate the fall after a release (in seconds)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grappling|Release Solver", meta = (ClampMin = "0"))
+	float ReleaseFallTime = 1;
+
+	//the time step the release solver simulates with (in seconds)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grappling|Release Solver", meta = (ClampMin = "0.001"))
+	float ReleaseTimeStep = 1.f / 60.f;
+
+	//how many release times the release solver should test
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grappling|Release Solver", meta = (ClampMin = "2"))
+	int32 NumReleaseCandidates = 32;
+
+	//whether or not the release solver is currently running
+	UPROPERTY(BlueprintReadOnly, Category = "Grappling|Release Solver")
+	bool bIsSolvingRelease = false;
+
 	//the amount of pending score to give from the grapple
 	UPROPERTY(BlueprintReadOnly)
 	float PendingScore = 0;
@@ -168,6 +245,22 @@ public:
 	//storage for the grapple hit(s) we have
 	TArray<FHitResult> GrappleHits;
 
+	//the pull response tables for each score tier
+	TArray<FGrapplePullResponseTable> PullResponseTables;
+
+private:
+
+	//the cached set of nearby primitives the grapple can hit
+	FGrappleCandidateSet GrappleCandidates;
+
+	//the hits of the camera ray against the candidate set this frame (traced to the longest distance we check so every check this frame can reuse it)
+	TArray<FHitResult> CandidateRayHits;
+
+	//the frame the candidate ray hits were traced on
+	uint64 CandidateRayFrame = 0;
+
+public:
+
 	//constructor
 	UGrapplingComponent();
 
@@ -190,6 +283,10 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void StopGrappleCheck();
 
+	//function to start solving for the best time to release the grapple on a worker thread (OnReleaseSolved is called with the result, returns false if we aren't grappling or are already solving)
+	UFUNCTION(BlueprintCallable)
+	bool SolveReleaseAsync(TEnumAsByte<EGrappleReleaseObjective> Objective);
+
 	//function to process the grapple input
 	UFUNCTION(BlueprintCallable)
 	FVector ProcessGrappleInput(FVector MovementInput);
@@ -210,6 +307,12 @@ private:
 	//function to do the grapple trace with a given max distance
 	void DoGrappleTrace(float MaxDistance, bool DoSphereTrace);
 
+	//function to update the aim assist target, returns whether or not one was found
+	bool UpdateAimAssistTarget();
+
+	//function to try and do the grapple trace against the candidate set near the camera (and the scene beyond it), returns false if a full scene trace is needed instead
+	bool DoCandidateGrappleTrace(TArray<FHitResult>& OutHits, const FVector& CameraLocation, const FVector& Direction, float MaxDistance);
+
 	//function to check for force modifiers based on the grappleable component of the target we're grappling to
 	void CheckTargetForceModifiers(FVector& BaseVel, float DeltaTime) const;
 
@@ -222,6 +325,10 @@ private:
 	UFUNCTION()
 	void OnGrappleTargetDestroyed(AActor* DestroyedActor);
 
+	//function to update the grapple gravity scale when the player's score tier changes
+	UFUNCTION()
+	void OnScoreTierChanged(int32 NewTier, int32 OldTier);
+
 public:
 	/**
 	 * Getters
@@ -239,6 +346,13 @@ public:
 	UFUNCTION(BlueprintCallable)
 	TEnumAsByte<EGrapplingMode> GetGrappleMode() const;
 
+	//function to get the pull force multiplier from the score values' angle, distance and velocity curves (or the pull response table of the current tier)
+	float GetPullForceMultiplier(const FVector& GrappleVelocity, float DeltaTime) const;
+
+	//function to bake the pull response tables from the score values (call again after changing the curves at runtime)
+	UFUNCTION(BlueprintCallable)
+	void BakePullResponseTables();
+
 	//function to get the dot product of the grapple direction and the player's velocity
 	UFUNCTION()
 	float GetGrappleDotProduct(FVector GrappleVelocity) const;
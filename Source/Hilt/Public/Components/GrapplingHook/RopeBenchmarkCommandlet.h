@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "RopeBenchmarkCommandlet.generated.h"
+
+//struct for a canned rope benchmark scenario
+struct FRopeBenchmarkScenario
+{
+	//the name of the scenario
+	FString Name;
+
+	//whether or not the rope uses verlet integration and how many verlet points it has
+	bool bUseVerletIntegration = false;
+	int32 NumVerletPoints = 0;
+
+	//whether or not the rope uses sphere sweeps for its collision
+	bool bUseSweptCollision = false;
+
+	//the length of the rope
+	float RopeLength = 2000;
+
+	//the number of boxes placed along the rope for it to wrap around
+	int32 NumBoxes = 0;
+};
+
+//struct for the results of a rope benchmark scenario
+struct FRopeBenchmarkResult
+{
+	//the average and worst time per frame (in milliseconds)
+	double AverageFrameMs = 0;
+	double MaxFrameMs = 0;
+
+	//the average number of scene queries per frame
+	double QueriesPerFrame = 0;
+
+	//the number of allocations after the rope was activated
+	int32 Allocations = 0;
+
+	//the number of rope points at the end of the benchmark
+	int32 FinalRopePoints = 0;
+};
+
+/**
+ * @class URopeBenchmarkCommandlet
+ * @brief Runs canned rope scenarios in an empty world and reports time, scene queries and allocations per frame.
+ *
+ * Run headless with: UnrealEditor-Cmd Compulsory2.uproject -run=RopeBenchmark [-Frames=300] [-Scenario=Name] [-Csv]
+ * The same scenarios also run as the Hilt.Rope.Benchmark automation tests.
+ */
+UCLASS()
+class URopeBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	//constructor
+	URopeBenchmarkCommandlet();
+
+	//override(s)
+	virtual int32 Main(const FString& Params) override;
+
+	//function to get the canned scenarios
+	static TArray<FRopeBenchmarkScenario> GetScenarios();
+
+	//function to run a scenario for a number of frames in a new world
+	static FRopeBenchmarkResult RunScenario(const FRopeBenchmarkScenario& Scenario, int32 NumFrames);
+};
@@ -59,9 +59,33 @@ struct FRopePoint
 	explicit FRopePoint(const FHitResult& HitResult);
 	explicit FRopePoint(AActor* InOtherActor, const FVector& InLocation);
 
-	//function to get the location of the rope point in world space
+	//the scene component the world location was last resolved from (cached so the grappleable component isn't searched for on every call)
+	mutable TWeakObjectPtr<USceneComponent> ResolvedSource = nullptr;
+
+	//the cached world location of the rope point (not used in world space)
+	mutable FVector CachedWL = FVector::ZeroVector;
+
+	//the frame the cached world location was resolved on
+	mutable uint64 CachedFrame = 0;
+
+	//whether or not the cached world location is valid
+	mutable bool bIsCacheValid = false;
+
+	//whether or not the cached world location is only valid for the frame it was resolved on (for sockets, which can move without their component moving)
+	mutable bool bCachePerFrame = false;
+
+	//function to get the location of the rope point in world space (cached until the source component's transform changes)
 	FVector GetWL() const;
 
+	//function to get the location of the rope point in world space without using the cache
+	FVector ResolveWL() const;
+
+	//function to get the scene component whose transform the world location depends on (nullptr in world space)
+	USceneComponent* GetTransformSource() const;
+
+	//function to invalidate the cached world location
+	void InvalidateCache() const { bIsCacheValid = false; }
+
 	//function to set the location of the rope point in world space (if using relative location, will set the location of the attached actor)
 	void SetWL(const FVector& NewLocation);
 };
@@ -113,6 +137,37 @@ struct FVerletConstraint
 	void SetDistance(float NewDistance);
 };
 
+//struct for the settings of a rope level of detail (used when the rope is far away from the camera or small on screen)
+USTRUCT(BlueprintType)
+struct FRopeLODSettings
+{
+	GENERATED_BODY()
+
+	//the distance from the camera at which this lod starts being used
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0"))
+	float MinDistance = 0.f;
+
+	//the screen size (fraction of the screen height the rope's bounds cover) below which this lod starts being used
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0"))
+	float MaxScreenSize = 0.f;
+
+	//the scale to apply to the number of verlet points when the rope is activated at this lod
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0", ClampMax = "1"))
+	float VerletPointScale = 1.f;
+
+	//the scale to apply to the number of constraint iterations per frame
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0", ClampMax = "1"))
+	float ConstraintIterationScale = 1.f;
+
+	//how many frames to wait between each check of the rope's collision points
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "1"))
+	int32 CollisionCheckInterval = 1;
+
+	//how many rope points each rendered segment spans (collision points are never skipped)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "1"))
+	int32 RenderStride = 1;
+};
+
 UCLASS()
 class URopeComponent : public USceneComponent
 {
@@ -136,6 +191,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, category = "Rope")
 	float RopeRadius = 10.f;
 
+	//whether or not to use sphere sweeps with the rope radius instead of line traces for the rope's collision checks (for visually thick ropes)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Thick Rope")
+	bool bUseSweptCollision = false;
+
+	//the max number of sphere sweeps the rope can do per frame before falling back to line traces (0 = no limit)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Thick Rope", meta = (EditCondition = "bUseSweptCollision", ClampMin = "0"))
+	int32 MaxSweepsPerFrame = 64;
+
 	//the Niagara system used to render the rope
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|Rendering")
 	TObjectPtr<UNiagaraSystem> NiagaraSystem = nullptr;
@@ -148,6 +211,14 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Rope|Rendering")
 	TArray<UNiagaraComponent*> NiagaraComponents;
 
+	//array of deactivated niagara components that can be reused instead of spawning new ones
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Rope|Rendering")
+	TArray<UNiagaraComponent*> FreeNiagaraComponents;
+
+	//the number of collision points to reserve space for on top of the verlet points (so wrapping the rope around geometry doesn't reallocate the rope points)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope", meta = (ClampMin = "0"))
+	int32 ReservedCollisionPoints = 32;
+
 	//the minimum spacing between new and old rope points in the infinite length rope mode
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, category = "Rope")
 	float MinCollisionPointSpacing = 20.f;
@@ -212,9 +283,35 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Verlet Integration")
 	float RopeMass = 1;
 
+	//the velocity of the wind acting on the rope points (the drag is calculated relative to this)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Verlet Integration")
+	FVector WindVelocity = FVector::ZeroVector;
+
 	//array of collision points for the rope
 	TArray<FRopePoint*> CollisionPoints;
 
+	//the lods of the rope, ordered from most to least detailed (lod 0 is the rope's own settings and is used when no entry applies)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|LOD")
+	TArray<FRopeLODSettings> LODSettings;
+
+	//whether or not to stop simulating and rendering the rope while it's outside of the camera's view
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rope|LOD")
+	bool bFreezeWhenOffScreen = true;
+
+	//the index of the lod the rope is currently using (INDEX_NONE = full detail)
+	UPROPERTY(BlueprintReadOnly, Category = "Rope|LOD")
+	int32 CurrentLODIndex = INDEX_NONE;
+
+	//whether or not the rope is currently frozen because it's off-screen
+	UPROPERTY(BlueprintReadOnly, Category = "Rope|LOD")
+	bool bIsOffScreen = false;
+
+	//the total number of scene queries (traces and sweeps) the rope has done
+	mutable int32 NumSceneQueries = 0;
+
+	//the total number of allocations (array growth and niagara component spawns) the rope has done
+	int32 NumAllocations = 0;
+
 private:
 	//whether or not the rope is currently active
 	UPROPERTY(BlueprintReadOnly, Category = "Rope", meta=(AllowPrivateAccess))
@@ -224,6 +321,38 @@ private:
 	UPROPERTY(BlueprintReadOnly, Category = "Rope", meta = (AllowPrivateAccess))
 	class APlayerCharacter* PlayerCharacter = nullptr;
 
+	//the number of sphere sweeps done this frame (reset at the start of every tick)
+	mutable int32 NumSweepsThisFrame = 0;
+
+	//scratch array for the accelerations calculated in the force accumulation pass of the verlet integration
+	TArray<FVector> NewAccelerations;
+
+	//the number of frames since the collision points were last checked
+	int32 FramesSinceCollisionCheck = 0;
+
+	//the capacities of the rope arrays when the allocations were last counted
+	int32 LastRopePointsMax = 0;
+	int32 LastConstraintsMax = 0;
+	int32 LastCollisionPointsMax = 0;
+
+	//function to count the allocations of the rope arrays since the last count (an allocation happened if the capacity changed)
+	void CountArrayAllocations();
+
+	//function to deactivate a niagara component and add it to the free list
+	void ReleaseNiagaraComponent(UNiagaraComponent* NiagaraComponent);
+
+	//the components whose transform updates we're bound to (so the cached world locations of the rope points attached to them can be invalidated)
+	TMap<TWeakObjectPtr<USceneComponent>, FDelegateHandle> BoundTransformSources;
+
+	//function to bind to the transform updates of the components the rope points are attached to
+	void BindTransformSources();
+
+	//function to unbind from the transform updates of all the components the rope points are attached to
+	void UnbindTransformSources();
+
+	//function called when the transform of a component a rope point is attached to changes
+	void OnTransformSourceUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
 public:
 
 	//constructor
@@ -234,6 +363,9 @@ public:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	virtual void DestroyComponent(bool bPromoteChildren) override;
 
+	//function to do everything the rope does in a frame (called from the tick, and directly when benchmarking)
+	void SimulateRope(float DeltaTime);
+
 	//function to enforce the constraints of the rope
 	void EnforceConstraints();
 
@@ -248,6 +380,9 @@ public:
 	//function to apply forces to the rope point (used for velocity-verlet integration)
 	FVector CalculateAccel(const FRopePoint& RopePoint) const;
 
+	//function to get the parameters used for the rope's force accumulation
+	struct FRopeForceParams GetForceParams() const;
+
 	//function for switching the rope niagara system
 	UFUNCTION(BlueprintCallable, Category = "Rope")
 	void SetNiagaraSystem(UNiagaraSystem* NewSystem);
@@ -255,11 +390,17 @@ public:
 	//function to get the collision query params used for the rope's collision checks
 	FCollisionQueryParams GetCollisionParams() const;
 
+	//does a collision check between two points using a sphere sweep in the thick rope mode (while within the sweep budget) and a line trace otherwise
+	bool RopeTrace(FHitResult& OutHit, const FVector& Start, const FVector& End, const FCollisionQueryParams& CollisionParams) const;
+
 	//traces along the collision points and removes unnecessary collision points
 	void CheckCollisionPoints();
 
-	//spawns a new niagara system for a rope point at the given index in the rope points array, pointing towards the next point in the array (not called for the last point in the array)
-	void SpawnNiagaraSystem(int Index);
+	//spawns a new niagara system for a rope point at the given index in the rope points array, pointing towards the point at the end index (defaults to the next point in the array, not called for the last point in the array)
+	void SpawnNiagaraSystem(int Index, int EndIndex = INDEX_NONE);
+
+	//updates the current lod and off-screen state of the rope based on the camera
+	void UpdateLOD();
 
 	//renders the rope using the niagara system
 	void RenderRope();
@@ -291,4 +432,12 @@ public:
 	//function to get the second rope point
 	UFUNCTION(BlueprintCallable, Category = "Rope")
 	FVector GetSecondRopePoint() const;
+
+	//function to get the settings of the lod the rope is currently using
+	UFUNCTION(BlueprintCallable, Category = "Rope|LOD")
+	FRopeLODSettings GetCurrentLODSettings() const;
+
+	//function to get the bounding box of all the rope points
+	UFUNCTION(BlueprintCallable, Category = "Rope")
+	FBox GetRopeBounds() const;
 };
@@ -0,0 +1,35 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FRopePoint;
+
+//struct for the parameters used when accumulating the forces acting on the rope points
+struct FRopeForceParams
+{
+	//the gravity acceleration to apply to every rope point
+	FVector Gravity = FVector::ZeroVector;
+
+	//the velocity of the air around the rope (drag is calculated relative to this)
+	FVector WindVelocity = FVector::ZeroVector;
+
+	//the quadratic drag coefficient of the rope
+	float Drag = 0.f;
+
+	//the mass of each rope point
+	float Mass = 1.f;
+};
+
+namespace RopeForces
+{
+	//calculates the acceleration of every rope point (gravity and signed quadratic drag) in a single vectorized pass, optionally using a per point wind field instead of the uniform wind velocity
+	void AccumulateAccelerations(const FRopePoint* Points, int32 NumPoints, const FRopeForceParams& Params, FVector* OutAccelerations, const FVector* WindField = nullptr);
+
+	//scalar reference implementation of the acceleration of a single rope point
+	FVector CalculateAcceleration(const FVector& Velocity, const FVector& WindVelocity, const FRopeForceParams& Params);
+
+	//scalar reference implementation of AccumulateAccelerations
+	void AccumulateAccelerationsScalar(const FRopePoint* Points, int32 NumPoints, const FRopeForceParams& Params, FVector* OutAccelerations, const FVector* WindField = nullptr);
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "CollisionQueryParams.h"
+#include "Core/GameplaySchedulerSubsystem.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "PlayerMovementComponent.generated.h"
@@ -201,6 +202,30 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Diving")
 	float DiveGravityScaleMultiplier = 8;
 
+	//whether or not to raise the number of movement substeps when the player is moving fast enough to move more than a fraction of their capsule radius per substep (prevents tunneling through thin geometry at grapple speeds)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Continuous Collision")
+	bool bUseAdaptiveSubstepping = false;
+
+	//the speed the player has to be moving at before adaptive substepping is used (keeps normal running and sliding on the default substeps)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Continuous Collision", meta = (EditCondition = "bUseAdaptiveSubstepping", ClampMin = "0"))
+	float MinAdaptiveSubstepSpeed = 3000;
+
+	//the fraction of the capsule radius the player is allowed to move per substep before more substeps are used
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Continuous Collision", meta = (EditCondition = "bUseAdaptiveSubstepping", ClampMin = "0.05", ClampMax = "2"))
+	float AdaptiveSubstepRadiusFraction = 0.5f;
+
+	//the max number of substeps to use when adaptive substepping (the cap so very high speeds can't stall the frame)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Continuous Collision", meta = (EditCondition = "bUseAdaptiveSubstepping", ClampMin = "1", ClampMax = "25"))
+	int32 MaxAdaptiveSimulationIterations = 16;
+
+	//the number of substeps the last movement was allowed to use
+	UPROPERTY(BlueprintReadOnly, Category = "Movement|Continuous Collision")
+	int32 CurrentSimulationIterations = 0;
+
+	//the max simulation time step and iterations used at begin play (restored after every adaptive movement)
+	float DefaultMaxSimulationTimeStep = 0.05f;
+	int32 DefaultMaxSimulationIterations = 8;
+
 	//the direction of the last directional jump
 	FVector LastSuperJumpDirection = FVector::UpVector;
 
@@ -217,7 +242,10 @@ public:
 	bool bIsSlideJumping = false;
 
 	//timer handle for banking slide score
-	FTimerHandle SlideScoreBankTimer;
+	FGameplayTimerHandle SlideScoreBankTimer;
+
+	//timer handle for resetting the gravity after a slide jump
+	FGameplayTimerHandle SlideJumpGravityResetTimer;
 
 	//the gravity scale used at begin play
 	float DefaultGravityScale = 1;
@@ -286,6 +314,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Movement")
 	void BankSlideScore();
 
+	//function to stop the slide and slide jump and cancel their timers (e.g. when the level restarts)
+	UFUNCTION(BlueprintCallable, Category = "Movement")
+	void ResetTransientState();
+
 	//function to get the direction the player is currently sliding
 	UFUNCTION(BlueprintCallable, Category = "Movement")
 	FVector GetSlideSurfaceDirection();
@@ -302,6 +334,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Movement")
 	bool IsDiving() const;
 
+	//function to raise the substep count for this movement if the player would move too far per substep (returns whether or not the settings were changed)
+	bool ApplyAdaptiveSubstepping(float DeltaTime);
+
 	//override functions
 	virtual void BeginPlay() override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
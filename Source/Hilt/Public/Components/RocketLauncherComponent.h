@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Helpers/ExplosionSubsystem.h"
 #include "Helpers/ProjectileGunComponent.h"
 #include "RocketLauncherComponent.generated.h"
 
@@ -51,9 +52,17 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Rocket Launcher")
 	bool bEnableReloading = false;
 
-	//the rocket explosion class to spawn when the rocket hits something
+	//the rocket explosion class to spawn when the rocket hits something (only used for visuals when using the native explosion)
 	UPROPERTY(EditAnywhere, Category = "Rocket Launcher")
 	TSubclassOf<AActor> RocketExplosionClass;
+
+	//whether or not to apply the explosion's impulse and damage natively with the explosion subsystem
+	UPROPERTY(EditAnywhere, Category = "Rocket Launcher")
+	bool bUseNativeExplosion = false;
+
+	//the settings of the native explosion
+	UPROPERTY(EditAnywhere, Category = "Rocket Launcher", meta = (EditCondition = "bUseNativeExplosion"))
+	FExplosionParams ExplosionParams;
 	
 	//override(s)
 	virtual AActor* FireProjectile(FVector Direction) override;
@@ -29,8 +29,21 @@ class UTerrainGunComponent : public UProjectileGunComponent
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float ProjectileLifeTime = 5.0f;
 
-	//timer handle to turn the projectile into terrain
-	FTimerHandle TerrainTimerHandle;
+	//the mesh of the terrain (if set the terrain is placed as an instance of a shared instanced mesh instead of spawning TerrainClass)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	UStaticMesh* TerrainMesh = nullptr;
+
+	//the scale of the terrain
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FVector TerrainScale = FVector(1);
+
+	//the max amount of terrain that can exist at once (the oldest terrain is removed first, 0 = no limit)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 MaxTerrainCount = 30;
+
+	//how long the terrain lasts before it's removed (0 = until it's recycled)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float TerrainLifeTime = 0;
 
 	//delegate to handle when the terrain is spawned
 	UPROPERTY(BlueprintAssignable)
@@ -41,9 +54,16 @@ class UTerrainGunComponent : public UProjectileGunComponent
 
 	virtual AActor* FireProjectile(FVector Direction) override;
 	virtual void OnProjectileHit(AActor* Projectile, AActor* OtherActor, FVector NormalImpulse, const FHitResult& Hit) override;
+	virtual void OnSimulatedProjectileExpired(const FVector& Location, const FRotator& Rotation) override;
+	virtual float GetPooledProjectileLifeTime() const override;
 
 	//function to handle when the projectile's time is up
 	UFUNCTION()
-	void OnProjectileExpired(AActor* Projectile) const;
+	void OnProjectileExpired(AActor* Projectile);
+
+private:
+
+	//function to place the terrain at a location and call the OnTerrainSpawned delegate
+	void SpawnTerrain(const FVector& Location, const FRotator& Rotation);
 
 };
@@ -0,0 +1,84 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/GameplaySchedulerSubsystem.h"
+#include "TerrainPlacementSubsystem.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UTerrainGunComponent;
+
+/**
+ * @class UTerrainPlacementSubsystem
+ * @brief Places the terrain spawned by terrain guns, keeps it under a budget and expires terrain projectiles.
+ *
+ * Terrain with a mesh is added as an instance of a shared instanced mesh component (one per mesh) so every platform of
+ * the same mesh is one component with one set of collision. Terrain without a mesh is spawned as an actor. When the
+ * budget is reached the oldest terrain is removed first. Projectile and terrain expiries are gameplay scheduler timers
+ * so scheduling and cancelling them is constant time no matter how many are waiting.
+ */
+UCLASS()
+class HILT_API UTerrainPlacementSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	//function to place terrain (returns the spawned actor, or the actor holding the instances if the terrain is instanced)
+	AActor* PlaceTerrain(TSubclassOf<AActor> TerrainClass, UStaticMesh* TerrainMesh, const FTransform& Transform, int32 MaxTerrainCount, float LifeTime);
+
+	//function to remove every placed terrain
+	UFUNCTION(BlueprintCallable, Category = "Terrain")
+	void ClearTerrain();
+
+	//function to get the number of placed terrain
+	UFUNCTION(BlueprintPure, Category = "Terrain")
+	int32 GetNumTerrain() const { return Placements.Num(); }
+
+	//function to turn a projectile into terrain after a delay (replaces an earlier expiry of the same projectile)
+	void ScheduleProjectileExpiry(UTerrainGunComponent* Gun, AActor* Projectile, float Delay);
+
+	//function to stop a projectile from expiring (e.g. when it hits something)
+	void CancelProjectileExpiry(const AActor* Projectile);
+
+private:
+
+	//struct for placed terrain
+	struct FTerrainPlacement
+	{
+		//the id of the placement (used by the expiry timer to check the placement still exists)
+		uint32 Id;
+
+		//the spawned actor (not set if the terrain is instanced)
+		TWeakObjectPtr<AActor> Actor;
+
+		//the index of the instanced mesh component and the index of the instance in it (INDEX_NONE if the terrain is an actor)
+		int32 MeshIndex;
+		int32 InstanceIndex;
+	};
+
+	//function to remove a placement (and its instance or actor)
+	void RemovePlacement(int32 PlacementIndex);
+
+	//function to get the index of the instanced mesh component of a mesh (creates it if needed)
+	int32 GetMeshIndex(UStaticMesh* Mesh);
+
+	//the placed terrain (oldest first)
+	TArray<FTerrainPlacement> Placements;
+
+	//the id of the next placement
+	uint32 NextId = 1;
+
+	//the expiry timer of every waiting projectile
+	TMap<TObjectKey<AActor>, FGameplayTimerHandle> ProjectileExpiryTimers;
+
+	//the actor holding the instanced mesh components
+	UPROPERTY()
+	AActor* InstanceActor = nullptr;
+
+	//the instanced mesh components (one per mesh)
+	UPROPERTY()
+	TArray<UInstancedStaticMeshComponent*> InstanceComponents;
+};
@@ -0,0 +1,79 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ActorTagSubsystem.generated.h"
+
+/**
+ * @class UActorTagSubsystem
+ * @brief Keeps an index of the actors of the world by their tags.
+ *
+ * Actors are indexed by the tags they have when they're loaded or spawned and removed when they're destroyed, so checking
+ * an actor's tag is a set lookup and getting the actors with a tag only visits those actors. Hidden levels keep their
+ * actors indexed, and actors of unloaded levels are dropped the next time their tags are listed or counted. Tags changed
+ * at runtime must go through AddTag and RemoveTag to keep the index in sync.
+ */
+UCLASS()
+class HILT_API UActorTagSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	//override(s)
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	//function to add a tag to an actor
+	UFUNCTION(BlueprintCallable, Category = "Tags")
+	void AddTag(AActor* Actor, FName Tag);
+
+	//function to remove a tag from an actor
+	UFUNCTION(BlueprintCallable, Category = "Tags")
+	void RemoveTag(AActor* Actor, FName Tag);
+
+	//function to check if an actor has a tag
+	UFUNCTION(BlueprintPure, Category = "Tags")
+	bool HasTag(const AActor* Actor, FName Tag);
+
+	//function to get the actors with a tag
+	UFUNCTION(BlueprintCallable, Category = "Tags")
+	void GetActorsWithTag(FName Tag, TArray<AActor*>& OutActors);
+
+	//function to get the number of actors with a tag
+	UFUNCTION(BlueprintPure, Category = "Tags")
+	int32 GetNumActorsWithTag(FName Tag);
+
+private:
+
+	//function to index every actor of the world if it hasn't been done yet
+	void IndexWorld();
+
+	//function to add an actor to the sets of its tags
+	void IndexActor(AActor* Actor);
+
+	//function to remove an actor from the sets of its tags
+	void UnindexActor(AActor* Actor);
+
+	//function called when an actor is spawned
+	void OnActorSpawned(AActor* Actor);
+
+	//function called when an actor is destroyed
+	void OnActorDestroyed(AActor* Actor);
+
+	//function called when a level is added to a world
+	void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+
+	//the actors of each tag
+	TMap<FName, TSet<TObjectKey<AActor>>> TaggedActors;
+
+	//whether or not the actors of the world have been indexed
+	bool bWorldIndexed = false;
+
+	//the handles of the delegates we're bound to
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle ActorDestroyedHandle;
+	FDelegateHandle LevelAddedHandle;
+};
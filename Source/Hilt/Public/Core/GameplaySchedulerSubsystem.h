@@ -0,0 +1,188 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplaySchedulerSubsystem.generated.h"
+
+//struct for a handle to a timer of the gameplay scheduler (a default handle is invalid)
+struct FGameplayTimerHandle
+{
+	//the index of the timer in the scheduler
+	int32 Index = INDEX_NONE;
+
+	//the serial of the timer when the handle was made (a reused timer has a new serial so old handles stop working)
+	uint32 Serial = 0;
+
+	//function to check if the handle was set (doesn't check if the timer is still active)
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+	//function to reset the handle
+	void Invalidate() { Index = INDEX_NONE; Serial = 0; }
+};
+
+//struct for the stats of the gameplay scheduler
+USTRUCT(BlueprintType)
+struct FGameplaySchedulerStats
+{
+	GENERATED_BODY()
+
+	//the number of timers waiting to fire
+	UPROPERTY(BlueprintReadOnly)
+	int32 NumPending = 0;
+
+	//the most timers that have been waiting at once
+	UPROPERTY(BlueprintReadOnly)
+	int32 PeakPending = 0;
+
+	//the number of timers that fired last frame
+	UPROPERTY(BlueprintReadOnly)
+	int32 NumFiredLastFrame = 0;
+
+	//the number of scheduler steps taken last frame
+	UPROPERTY(BlueprintReadOnly)
+	int32 NumStepsLastFrame = 0;
+
+	//the number of timers that have fired since the world started
+	UPROPERTY(BlueprintReadOnly)
+	int32 TotalFired = 0;
+};
+
+/**
+ * @class UGameplaySchedulerSubsystem
+ * @brief Runs gameplay timers on a hierarchical timing wheel stepped at a fixed rate.
+ *
+ * Timers are stored in a reused array (no allocation per timer once it has grown) and referenced from the wheel by
+ * index and serial, so cancelling a timer is constant time. Each level of the wheel covers 64 times the range of the
+ * level below it and its slots are moved down a level as the wheel reaches them. Timers fire on fixed steps in the order
+ * they expire, looping timers are rescheduled from their expiry step so they don't drift, and timers whose owner has
+ * been destroyed are skipped. Every timer has an owner so they can be cancelled per owner or all at once on restart.
+ */
+UCLASS()
+class HILT_API UGameplaySchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	//the number of bits of the step used for the slot of each level (64 slots per level)
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 NumSlots = 1 << SlotBits;
+	static constexpr uint64 SlotMask = NumSlots - 1;
+
+	//the number of levels of the wheel
+	static constexpr int32 NumLevels = 4;
+
+	//how long each step of the scheduler lasts (in seconds, timers are rounded up to a step)
+	float StepTime = 1.f / 120.f;
+
+	//constructor
+	UGameplaySchedulerSubsystem();
+
+	//override(s)
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	//function to set a timer that calls a function after a delay (called every delay if looping, the owner is required and the timer is skipped if it's destroyed)
+	FGameplayTimerHandle SetTimer(const UObject* Owner, TFunction<void()>&& Callback, float Delay, bool bLoop = false);
+
+	//function to set a timer that calls a member function of the owner after a delay
+	template <typename T>
+	FGameplayTimerHandle SetTimer(T* Owner, void (T::*Function)(), const float Delay, const bool bLoop = false)
+	{
+		//call the member function (the owner is checked before the timer fires)
+		return SetTimer(Owner, [Owner, Function] { (Owner->*Function)(); }, Delay, bLoop);
+	}
+
+	//function to cancel a timer (invalidates the handle)
+	void ClearTimer(FGameplayTimerHandle& Handle);
+
+	//function to cancel every timer of an owner (returns the number of timers cancelled)
+	int32 ClearTimersForOwner(const UObject* Owner);
+
+	//function to cancel every timer
+	UFUNCTION(BlueprintCallable, Category = "Scheduler")
+	void ClearAllTimers();
+
+	//function to check if a timer is waiting to fire
+	bool IsTimerActive(const FGameplayTimerHandle& Handle) const;
+
+	//function to get the time until a timer fires (in seconds, -1 if the timer isn't active)
+	float GetTimerRemaining(const FGameplayTimerHandle& Handle) const;
+
+	//function to get the stats of the scheduler
+	UFUNCTION(BlueprintPure, Category = "Scheduler")
+	const FGameplaySchedulerStats& GetStats() const { return Stats; }
+
+private:
+
+	//struct for a timer
+	struct FScheduledTimer
+	{
+		//the function to call when the timer fires
+		TFunction<void()> Callback;
+
+		//the owner of the timer
+		TWeakObjectPtr<const UObject> Owner;
+
+		//the step the timer fires on
+		uint64 ExpireStep = 0;
+
+		//the number of steps between each time a looping timer fires (0 = not looping)
+		uint32 IntervalSteps = 0;
+
+		//the serial of the timer (increased every time the timer is freed)
+		uint32 Serial = 1;
+
+		//whether or not the timer is waiting to fire
+		bool bActive = false;
+	};
+
+	//struct for an entry of a slot of the wheel
+	struct FWheelEntry
+	{
+		//the index and serial of the timer (skipped if the timer was freed since the entry was added)
+		int32 Index;
+		uint32 Serial;
+	};
+
+	//function to move the wheel forward one step and fire the timers of the step
+	void Step();
+
+	//function to add a timer to the slot of the wheel it expires in
+	void InsertTimer(int32 Index);
+
+	//function to move the timers of a slot of a level down to the levels below it
+	void CascadeSlot(int32 Level, int32 Slot);
+
+	//function to free a timer so it can be reused
+	void FreeTimer(int32 Index);
+
+	//function to check if a wheel entry still refers to an active timer
+	bool IsEntryActive(const FWheelEntry& Entry) const;
+
+	//function to get the number of steps until a delay has passed (at least one step)
+	uint32 GetStepsForDelay(float Delay) const;
+
+	//function to get a slot of a level of the wheel
+	TArray<FWheelEntry>& GetSlot(const int32 Level, const int32 Slot) { return Wheel[Level * NumSlots + Slot]; }
+
+	//the timers (freed timers are reused)
+	TArray<FScheduledTimer> Timers;
+
+	//the indices of the freed timers
+	TArray<int32> FreeIndices;
+
+	//the slots of every level of the wheel
+	TArray<FWheelEntry> Wheel[NumLevels * NumSlots];
+
+	//the last step the scheduler took
+	uint64 CurrentStep = 0;
+
+	//the time since the last step
+	float StepTimeAccumulator = 0;
+
+	//the stats of the scheduler
+	FGameplaySchedulerStats Stats;
+};
@@ -3,10 +3,12 @@
 // Includes
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
+#include "Core/GameplaySchedulerSubsystem.h"
 #include "HiltGameModeBase.generated.h"
 
 // Forward Declaration`s
 class ASpawnPoint;
+class URunTimerSubsystem;
 
 /**
  * @class AHiltGameModeBase.
@@ -19,6 +21,7 @@ class AHiltGameModeBase : public AGameModeBase
 public:
 	//  ---------------------- Public Variable`s ----------------------
 
+	// Timer fields are derived from the run timer subsystem every tick
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Variables-Time")
 	float TotalElapsedTime = 0.0f;
 	float LocalElapsedTime = 0.0f;
@@ -38,7 +41,7 @@ public:
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Variables-Time")
 	float RestartCooldown = 0.3f;
 	bool canRestart = true;
-	FTimerHandle RestartCooldownHandler;
+	FGameplayTimerHandle RestartCooldownHandler;
 
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Variables-Game")
 	int TotalNumActiveObjectives = 0;
@@ -75,6 +78,7 @@ public:
 	// Timer -----
 
 	void CountTime();
+	URunTimerSubsystem* GetRunTimer() const;
 	UFUNCTION(BlueprintCallable)
 	void StartTimer();
 	UFUNCTION(BlueprintCallable)
@@ -91,6 +95,9 @@ public:
 private:
 	//  --------------------- Private Function`s ----------------------
 
+	// Called by the objective registry when the number of objectives changes
+	UFUNCTION()
+	void OnObjectiveCountChanged(int32 NumActive, int32 NumTotal);
 
 public:
 	//  --------------- Getter`s / Setter`s / Adder`s -----------------
@@ -3,6 +3,9 @@
 
 namespace HiltTags
 {
+	//Tag for actors updated by the health and transform subsystems
+	static FName ECSTag = FName("ECS");
+
 	//Tag for actors that should not be grappled
 	static FName NoGrappleTag = FName("NoGrapple");
 
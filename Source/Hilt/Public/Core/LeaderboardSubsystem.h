@@ -0,0 +1,152 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RunTimerSubsystem.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Pipe.h"
+#include "LeaderboardSubsystem.generated.h"
+
+//struct for a run on the leaderboard
+USTRUCT(BlueprintType)
+struct FLeaderboardRun
+{
+	GENERATED_BODY()
+
+	//the total time of the run (in seconds)
+	UPROPERTY(BlueprintReadOnly)
+	double TotalTime = 0;
+
+	//when the run was finished
+	UPROPERTY(BlueprintReadOnly)
+	FDateTime Date;
+
+	//the id of the ghost recorded for the run (invalid if there is none)
+	UPROPERTY(BlueprintReadOnly)
+	FGuid GhostId;
+
+	//the time of each split from the start of the run (in seconds)
+	UPROPERTY(BlueprintReadOnly)
+	TArray<double> Splits;
+};
+
+//the fixed size record a run is stored as in the leaderboard file
+struct FLeaderboardFileRecord
+{
+	//the max number of splits stored per run
+	static constexpr int32 MaxSplits = 32;
+
+	//the total time of the run (in seconds)
+	double TotalTime = 0;
+
+	//when the run was finished (in ticks)
+	int64 DateTicks = 0;
+
+	//the id of the ghost recorded for the run
+	FGuid GhostId;
+
+	//the number of valid splits
+	int32 NumSplits = 0;
+
+	//padding so the splits are aligned
+	int32 Padding = 0;
+
+	//the time of each split from the start of the run (in seconds)
+	double Splits[MaxSplits] = {};
+};
+
+//the header at the start of the leaderboard file
+struct FLeaderboardFileHeader
+{
+	//the magic number and version of the file
+	uint32 Magic = 0x31424C48; // "HLB1"
+	uint32 Version = 1;
+
+	//the size of each record (so files written with a different record layout are rejected)
+	uint32 RecordSize = sizeof(FLeaderboardFileRecord);
+	uint32 Padding = 0;
+};
+
+//struct for an entry in the sorted leaderboard index
+struct FLeaderboardIndexEntry
+{
+	//the total time of the run
+	double TotalTime = 0;
+
+	//the index of the run in the records
+	int32 RecordIndex = 0;
+};
+
+/**
+ * @class ULeaderboardSubsystem
+ * @brief Stores every finished run of the current map in an append-only file under Saved/Leaderboards.
+ *
+ * The file is memory mapped once when the world starts and copied into memory with a sorted index of the run times,
+ * so top N queries are a slice of the index and rank lookups are a binary search. New runs are appended on a
+ * background pipe so the game thread never waits on the disk.
+ */
+UCLASS()
+class HILT_API ULeaderboardSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	//override(s)
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	//function to add a run to the leaderboard and write it to the file in the background (returns the rank of the run)
+	int32 SubmitRun(const FRunTimerRecord& Record, const FGuid& GhostId = FGuid());
+
+	//function to get the best runs (sorted by time)
+	UFUNCTION(BlueprintCallable, Category = "Leaderboard")
+	TArray<FLeaderboardRun> GetTopRuns(int32 Count) const;
+
+	//function to get the rank a time would have on the leaderboard (1 = best)
+	UFUNCTION(BlueprintCallable, Category = "Leaderboard")
+	int32 GetRankForTime(double TotalTime) const;
+
+	//function to get the number of runs on the leaderboard
+	UFUNCTION(BlueprintCallable, Category = "Leaderboard")
+	int32 GetNumRuns() const { return Records.Num(); }
+
+	//function to get the best run (returns false if there are no runs)
+	UFUNCTION(BlueprintCallable, Category = "Leaderboard")
+	bool GetBestRun(FLeaderboardRun& OutRun) const;
+
+	//function to get the path of the leaderboard file of the current map
+	FString GetLeaderboardPath() const;
+
+private:
+
+	//function to add a run to the leaderboard when the run timer finishes a run
+	UFUNCTION()
+	void OnRunFinished(const FRunTimerRecord& Record, bool bIsPersonalBest);
+
+	//function to load the leaderboard file of the current map
+	void LoadLeaderboard();
+
+	//function to add a record to the records and the sorted index
+	void AddRecord(const FLeaderboardFileRecord& Record);
+
+	//function to convert a stored record to a leaderboard run
+	static FLeaderboardRun ToRun(const FLeaderboardFileRecord& Record);
+
+	//the records of every run in the order they were finished
+	TArray<FLeaderboardFileRecord> Records;
+
+	//the run times sorted from best to worst
+	TArray<FLeaderboardIndexEntry> SortedIndex;
+
+	//the path of the leaderboard file
+	FString LeaderboardPath;
+
+	//the pipe the file writes run on (writes run one at a time in the order they were submitted)
+	UE::Tasks::FPipe WritePipe{ TEXT("LeaderboardWritePipe") };
+
+	//the last write launched on the pipe (waited on when the subsystem is deinitialized)
+	UE::Tasks::FTask LastWrite;
+};
@@ -0,0 +1,117 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ObjectiveRegistrySubsystem.generated.h"
+
+//struct for the completion of an objective
+USTRUCT(BlueprintType)
+struct FObjectiveCompletion
+{
+	GENERATED_BODY()
+
+	//the objective that was completed
+	UPROPERTY(BlueprintReadOnly)
+	AActor* Objective = nullptr;
+
+	//the type of the objective
+	UPROPERTY(BlueprintReadOnly)
+	FName ObjectiveType = NAME_None;
+
+	//the world time the objective was completed at (in seconds)
+	UPROPERTY(BlueprintReadOnly)
+	double WorldTime = 0;
+
+	//the time of the current run when the objective was completed (in seconds)
+	UPROPERTY(BlueprintReadOnly)
+	double RunTime = 0;
+
+	//the index of the run timer split recorded for the objective
+	UPROPERTY(BlueprintReadOnly)
+	int32 SplitIndex = INDEX_NONE;
+};
+
+/**
+ * @class UObjectiveRegistrySubsystem
+ * @brief Tracks the objectives of the level without searching the world for them.
+ *
+ * Objectives register themselves when they're initialized and report their completion here. Each completion records a
+ * run timer split and is broadcast with its timestamps, and the counts are broadcast whenever they change so the game
+ * mode never has to count the objectives itself. Any actor can be an objective by registering with a type.
+ */
+UCLASS()
+class HILT_API UObjectiveRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	//delegates for when an objective is completed, when the counts change and when the objectives are reset
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnObjectiveCompleted, const FObjectiveCompletion&, Completion);
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnObjectiveCountChanged, int32, NumActive, int32, NumTotal);
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnObjectivesReset);
+
+	//called when an objective is completed
+	UPROPERTY(BlueprintAssignable, Category = "Objectives")
+	FOnObjectiveCompleted OnObjectiveCompleted;
+
+	//called when the number of active or total objectives changes
+	UPROPERTY(BlueprintAssignable, Category = "Objectives")
+	FOnObjectiveCountChanged OnObjectiveCountChanged;
+
+	//called when the objectives are reset (objectives bind to this to reset themselves)
+	UPROPERTY(BlueprintAssignable, Category = "Objectives")
+	FOnObjectivesReset OnObjectivesReset;
+
+	//function to register an objective
+	UFUNCTION(BlueprintCallable, Category = "Objectives")
+	void RegisterObjective(AActor* Objective, FName ObjectiveType);
+
+	//function to unregister an objective
+	UFUNCTION(BlueprintCallable, Category = "Objectives")
+	void UnregisterObjective(AActor* Objective);
+
+	//function to complete an objective (returns false if the objective isn't registered or is already complete)
+	UFUNCTION(BlueprintCallable, Category = "Objectives")
+	bool CompleteObjective(AActor* Objective);
+
+	//function to set every objective back to active and clear the completions
+	UFUNCTION(BlueprintCallable, Category = "Objectives")
+	void ResetObjectives();
+
+	//function to get the number of objectives that haven't been completed
+	UFUNCTION(BlueprintPure, Category = "Objectives")
+	int32 GetNumActiveObjectives() const { return Objectives.Num() - Completions.Num(); }
+
+	//function to get the number of registered objectives
+	UFUNCTION(BlueprintPure, Category = "Objectives")
+	int32 GetNumObjectives() const { return Objectives.Num(); }
+
+	//function to get the completions since the last reset (in the order they were completed)
+	UFUNCTION(BlueprintPure, Category = "Objectives")
+	const TArray<FObjectiveCompletion>& GetCompletions() const { return Completions; }
+
+private:
+
+	//struct for a registered objective
+	struct FRegisteredObjective
+	{
+		//the type of the objective
+		FName ObjectiveType;
+
+		//whether or not the objective has been completed since the last reset
+		bool bCompleted = false;
+	};
+
+	//function to broadcast the current counts
+	void BroadcastCounts();
+
+	//the registered objectives
+	TMap<TObjectKey<AActor>, FRegisteredObjective> Objectives;
+
+	//the completions since the last reset
+	UPROPERTY()
+	TArray<FObjectiveCompletion> Completions;
+};
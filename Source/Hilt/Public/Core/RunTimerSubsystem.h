@@ -0,0 +1,133 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RunTimerSubsystem.generated.h"
+
+//struct for the times of a single run
+USTRUCT(BlueprintType)
+struct FRunTimerRecord
+{
+	GENERATED_BODY()
+
+	//the total time of the run (in seconds)
+	UPROPERTY(BlueprintReadOnly)
+	double TotalTime = 0;
+
+	//the time of each split from the start of the run (in seconds)
+	UPROPERTY(BlueprintReadOnly)
+	TArray<double> Splits;
+};
+
+/**
+ * @class URunTimerSubsystem
+ * @brief Times the current run from the double precision world time, records splits and keeps a ring buffer of finished runs and the personal best.
+ */
+UCLASS()
+class HILT_API URunTimerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	//delegates for when a split is recorded and when a run is finished
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnRunSplit, int32, SplitIndex, double, SplitTime, double, DeltaToBest);
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnRunFinished, const FRunTimerRecord&, Record, bool, bIsPersonalBest);
+
+	//called when a split is recorded (the delta to the personal best is 0 when there's no personal best split to compare against)
+	UPROPERTY(BlueprintAssignable, Category = "Run Timer")
+	FOnRunSplit OnRunSplit;
+
+	//called when a run is finished
+	UPROPERTY(BlueprintAssignable, Category = "Run Timer")
+	FOnRunFinished OnRunFinished;
+
+	//the max number of finished runs kept in the history
+	int32 HistoryCapacity = 32;
+
+	//override(s)
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	//function to start a new run from 0
+	UFUNCTION(BlueprintCallable, Category = "Run Timer")
+	void StartRun();
+
+	//function to pause the current run
+	UFUNCTION(BlueprintCallable, Category = "Run Timer")
+	void PauseRun();
+
+	//function to resume the current run
+	UFUNCTION(BlueprintCallable, Category = "Run Timer")
+	void ResumeRun();
+
+	//function to reset the current run to 0 (keeps running if it was running)
+	UFUNCTION(BlueprintCallable, Category = "Run Timer")
+	void ResetRun();
+
+	//function to record a split at the current time (returns the index of the split)
+	UFUNCTION(BlueprintCallable, Category = "Run Timer")
+	int32 RecordSplit();
+
+	//function to finish the current run, add it to the history and update the personal best
+	UFUNCTION(BlueprintCallable, Category = "Run Timer")
+	void FinishRun();
+
+	//function to get the elapsed time of the current run (in seconds)
+	UFUNCTION(BlueprintCallable, Category = "Run Timer")
+	double GetElapsedTime() const;
+
+	//function to get whether or not the current run is running
+	UFUNCTION(BlueprintCallable, Category = "Run Timer")
+	bool IsRunning() const { return bIsRunning; }
+
+	//function to get the splits of the current run
+	UFUNCTION(BlueprintCallable, Category = "Run Timer")
+	const TArray<double>& GetCurrentSplits() const { return CurrentSplits; }
+
+	//function to get the difference between a split of the current run and the same split of the personal best (0 if the personal best doesn't have that split)
+	UFUNCTION(BlueprintCallable, Category = "Run Timer")
+	double GetSplitDeltaToBest(int32 SplitIndex) const;
+
+	//function to get whether or not there is a personal best
+	UFUNCTION(BlueprintCallable, Category = "Run Timer")
+	bool HasPersonalBest() const { return bHasPersonalBest; }
+
+	//function to get the personal best
+	UFUNCTION(BlueprintCallable, Category = "Run Timer")
+	const FRunTimerRecord& GetPersonalBest() const { return PersonalBest; }
+
+	//function to set the personal best (e.g. when loaded from the leaderboard)
+	void SetPersonalBest(const FRunTimerRecord& Record);
+
+	//function to get the finished runs in the history from newest to oldest
+	UFUNCTION(BlueprintCallable, Category = "Run Timer")
+	TArray<FRunTimerRecord> GetHistory() const;
+
+private:
+
+	//function to get the current world time
+	double GetNow() const;
+
+	//whether or not the current run is running
+	bool bIsRunning = false;
+
+	//the world time the current run was last started or resumed at
+	double StartTime = 0;
+
+	//the time accumulated by the current run before it was last started or resumed
+	double AccumulatedTime = 0;
+
+	//the splits of the current run
+	TArray<double> CurrentSplits;
+
+	//the personal best and whether or not we have one
+	FRunTimerRecord PersonalBest;
+	bool bHasPersonalBest = false;
+
+	//the ring buffer of finished runs, the index the next run is written to and the number of runs in it
+	TArray<FRunTimerRecord> History;
+	int32 HistoryHead = 0;
+	int32 HistoryNum = 0;
+};
@@ -0,0 +1,141 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "StreamingManagerSubsystem.generated.h"
+
+class ULevelStreaming;
+
+//struct for a streaming level known to the streaming manager
+struct FStreamingLevelEntry
+{
+	//the streaming level
+	TWeakObjectPtr<ULevelStreaming> Level;
+
+	//the bounds of the level (cached while the level is loaded, used to predict which levels the player is heading into)
+	FBox Bounds = FBox(ForceInit);
+	bool bHasBounds = false;
+};
+
+//struct for a pending visibility change
+struct FStreamingRequest
+{
+	//whether the level should be visible or hidden
+	bool bVisible = true;
+
+	//the priority of the request (higher priorities are applied first)
+	int32 Priority = 0;
+
+	//the order the request was made in (older requests are applied first when the priorities are equal)
+	uint32 Sequence = 0;
+};
+
+/**
+ * @class UStreamingManagerSubsystem
+ * @brief Maps streaming level names to their levels once and applies visibility changes from a prioritized queue with a per-frame budget.
+ *
+ * Levels are keyed by their short package name without the play in editor prefix. Hidden levels stay loaded by default.
+ * The bounds of each level are cached once it's added to the world, and while the player moves, unloaded levels whose
+ * cached bounds lie along the player's predicted path are loaded ahead of time so showing them later only adds them to the world.
+ */
+UCLASS()
+class HILT_API UStreamingManagerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	//the max number of visibility changes applied per frame
+	int32 MaxVisibilityChangesPerFrame = 2;
+
+	//the priorities used for showing and hiding levels (showing is more urgent since the player is about to enter the level)
+	int32 ShowPriority = 1;
+	int32 HidePriority = 0;
+
+	//whether or not to unload levels when they're hidden (hidden levels stay loaded by default so showing them again doesn't hitch and their actors keep their state)
+	bool bUnloadHiddenLevels = false;
+
+	//whether or not to load the levels along the player's predicted path
+	bool bPredictFromVelocity = true;
+
+	//how far ahead to predict the player's path (in seconds), how often to update the prediction and how much to expand the level bounds by
+	float PredictionTime = 2.f;
+	float PredictionInterval = 0.25f;
+	float PredictionBoundsMargin = 1000.f;
+
+	//constructor
+	UStreamingManagerSubsystem();
+
+	//override(s)
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	//function to build the map of level names to streaming levels
+	void BuildLevelMap();
+
+	//function to request a level to be shown or hidden (applied over the next frames in priority order, a newer request for the same level replaces the older one)
+	void RequestVisibility(FName LevelName, bool bVisible, int32 Priority);
+
+	//function to request multiple levels to be shown
+	void RequestShowLevels(const TArray<FName>& LevelNames);
+
+	//function to request multiple levels to be hidden
+	void RequestHideLevels(const TArray<FName>& LevelNames);
+
+	//function to show every streaming level right away (skips the queue)
+	void ShowAllLevels();
+
+	//function to get the names of the visible and hidden streaming levels
+	void GetLevelNames(TArray<FName>& OutVisible, TArray<FName>& OutHidden);
+
+	//function to get the streaming level with the given name (also accepts any part of the level's package name)
+	ULevelStreaming* FindLevel(FName LevelName);
+
+	//function to get the number of levels the prediction has loaded ahead of time
+	int32 GetNumPredictedLoads() const { return NumPredictedLoads; }
+
+private:
+
+	//function to get the key in the level map of a requested name (NAME_None if there's no level with that name)
+	FName ResolveLevelName(FName LevelName);
+
+	//function to apply a visibility change to a level
+	void ApplyVisibility(FStreamingLevelEntry& Entry, bool bVisible) const;
+
+	//function to cache the bounds of a level if it's loaded and we don't have them yet
+	static void CacheBounds(FStreamingLevelEntry& Entry);
+
+	//function to load the levels along the player's predicted path
+	void PredictLevels();
+
+	//function called when a level is added to a world (caches the bounds of our streaming levels as soon as they're loaded)
+	void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+
+	//the handle of the level added binding
+	FDelegateHandle LevelAddedHandle;
+
+	//the streaming levels by name
+	TMap<FName, FStreamingLevelEntry> Levels;
+
+	//requested names that only matched part of a level's package name (so the string search only happens once per name)
+	TMap<FName, FName> Aliases;
+
+	//the number of streaming levels the map was built from (rebuilt when the world's streaming levels change)
+	int32 NumBuiltLevels = INDEX_NONE;
+
+	//the pending visibility changes by level name
+	TMap<FName, FStreamingRequest> PendingRequests;
+
+	//the sequence number of the next request
+	uint32 NextSequence = 0;
+
+	//the time until the next prediction update
+	float TimeUntilPrediction = 0;
+
+	//the number of levels the prediction has loaded ahead of time
+	int32 NumPredictedLoads = 0;
+};
@@ -0,0 +1,113 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EffectsSubsystem.generated.h"
+
+class UAudioComponent;
+class UNiagaraComponent;
+class UNiagaraSystem;
+class USoundBase;
+
+/**
+ * @class UEffectsSubsystem
+ * @brief Plays one shot Niagara systems and sounds from pools of components kept per asset.
+ *
+ * Finished components go back to the pool of their asset instead of being destroyed. Effects further than the cull
+ * distance from the camera are skipped, and only a budget of effects are started each frame, the rest wait for the
+ * next frames (and are dropped if they've waited too long) so many objects triggering effects at once don't spike.
+ */
+UCLASS()
+class HILT_API UEffectsSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	//the max number of Niagara systems started each frame
+	int32 MaxNiagaraSpawnsPerFrame = 4;
+
+	//the max number of sounds started each frame
+	int32 MaxAudioSpawnsPerFrame = 4;
+
+	//how far from the camera Niagara systems are played (0 = no culling)
+	float NiagaraCullDistance = 15000;
+
+	//how far from the camera sounds are played (0 = no culling)
+	float AudioCullDistance = 10000;
+
+	//how long an effect can wait for the budget before it's dropped (in seconds)
+	float MaxDeferTime = 0.25f;
+
+	//the max number of free components kept per asset
+	int32 MaxFreeComponentsPerAsset = 8;
+
+	//constructor
+	UEffectsSubsystem();
+
+	//override(s)
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual void Deinitialize() override;
+
+	//function to play a Niagara system at a location
+	UFUNCTION(BlueprintCallable, Category = "Effects")
+	void PlayNiagaraAtLocation(UNiagaraSystem* System, FVector Location, FRotator Rotation = FRotator::ZeroRotator);
+
+	//function to play a sound at a location
+	UFUNCTION(BlueprintCallable, Category = "Effects")
+	void PlaySoundAtLocation(USoundBase* Sound, FVector Location);
+
+private:
+
+	//struct for an effect waiting for the budget
+	struct FDeferredEffect
+	{
+		//the asset to play (one of these is set)
+		TWeakObjectPtr<UNiagaraSystem> System;
+		TWeakObjectPtr<USoundBase> Sound;
+
+		//where to play the effect
+		FVector Location;
+		FRotator Rotation;
+
+		//the time the effect was requested
+		double RequestTime;
+	};
+
+	//function to start a Niagara system from its pool
+	void StartNiagara(UNiagaraSystem* System, const FVector& Location, const FRotator& Rotation);
+
+	//function to start a sound from its pool
+	void StartSound(USoundBase* Sound, const FVector& Location);
+
+	//function to check if a location is too far from the camera
+	bool IsCulled(const FVector& Location, float CullDistance) const;
+
+	//function called when a pooled Niagara component finishes
+	UFUNCTION()
+	void OnNiagaraFinished(UNiagaraComponent* Component);
+
+	//function called when a pooled audio component finishes
+	void OnAudioFinished(UAudioComponent* Component);
+
+	//the number of effects started this frame
+	int32 NiagaraSpawnsThisFrame = 0;
+	int32 AudioSpawnsThisFrame = 0;
+
+	//the effects waiting for the budget (oldest first)
+	TArray<FDeferredEffect> DeferredEffects;
+
+	//the free components of each asset
+	TMap<TObjectKey<UNiagaraSystem>, TArray<UNiagaraComponent*>> FreeNiagaraComponents;
+	TMap<TObjectKey<USoundBase>, TArray<UAudioComponent*>> FreeAudioComponents;
+
+	//every component made by the subsystem (keeps them from being garbage collected)
+	UPROPERTY()
+	TArray<UNiagaraComponent*> NiagaraComponents;
+
+	UPROPERTY()
+	TArray<UAudioComponent*> AudioComponents;
+};
@@ -0,0 +1,77 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ExplosionSubsystem.generated.h"
+
+class UCurveFloat;
+
+//struct for the settings of an explosion
+USTRUCT(BlueprintType)
+struct FExplosionParams
+{
+	GENERATED_BODY()
+
+	//the radius of the explosion
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Radius = 500;
+
+	//the impulse applied to the player at the center of the explosion
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Impulse = 2000;
+
+	//whether or not the impulse is a velocity change (ignores the mass of the player)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bVelocityChange = true;
+
+	//the damage dealt at the center of the explosion
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Damage = 50;
+
+	//whether or not the instigator of the explosion takes damage (the impulse is always applied so rocket jumps work)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bDamageInstigator = false;
+
+	//the float curve for the impulse falloff using the distance divided by the radius (0 = center, 1 = edge, linear falloff if not set)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	UCurveFloat* ImpulseFalloffCurve = nullptr;
+
+	//the float curve for the damage falloff using the distance divided by the radius (0 = center, 1 = edge, linear falloff if not set)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	UCurveFloat* DamageFalloffCurve = nullptr;
+};
+
+/**
+ * @class UExplosionSubsystem
+ * @brief Applies explosions natively with one overlap query: impulses to the player's movement component and physics bodies, and batched damage to health components.
+ *
+ * Falloff curves are baked to tables the first time they're used.
+ */
+UCLASS()
+class HILT_API UExplosionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	//the number of samples falloff curves are baked into
+	int32 FalloffTableResolution = 64;
+
+	//function to apply an explosion at a location (returns the number of actors affected)
+	UFUNCTION(BlueprintCallable, Category = "Explosion")
+	int32 Explode(const FVector& Location, const FExplosionParams& Params, AActor* Instigator);
+
+	//function to clear the baked falloff tables (call after changing falloff curves at runtime)
+	UFUNCTION(BlueprintCallable, Category = "Explosion")
+	void ClearFalloffTables();
+
+private:
+
+	//function to get the falloff at a normalized distance from a curve's baked table
+	float GetFalloff(const UCurveFloat* Curve, float NormalizedDistance);
+
+	//the baked falloff tables by curve
+	TMap<TObjectKey<UCurveFloat>, TArray<float>> FalloffTables;
+};
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
+#include "Helpers/SimulatedProjectileSubsystem.h"
 #include "ProjectileGunComponent.generated.h"
 
 /** 
@@ -38,6 +39,26 @@ class UProjectileGunComponent : public USceneComponent
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	bool bAllowAlternativeActions = true;
 
+	//whether or not to reuse projectiles from the projectile pool instead of spawning and destroying them
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling")
+	bool bUseProjectilePool = true;
+
+	//the number of projectiles to spawn into the pool when the component begins play
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling", meta = (EditCondition = "bUseProjectilePool", ClampMin = "0"))
+	int32 PoolPrewarmCount = 4;
+
+	//how long a pooled projectile can fly before it's returned to the pool when the projectile class has no initial life span (0 = never)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling", meta = (EditCondition = "bUseProjectilePool", ClampMin = "0"))
+	float PooledProjectileLifeTime = 10.f;
+
+	//whether or not to fire simulated projectiles (no projectile actor, simulated by the simulated projectile subsystem) instead of spawning the projectile class
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulated Projectiles")
+	bool bUseSimulatedProjectiles = false;
+
+	//the settings of the simulated projectiles
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulated Projectiles", meta = (EditCondition = "bUseSimulatedProjectiles"))
+	FSimulatedProjectileParams SimulatedProjectileParams;
+
 	//storage for the owner of this component as a player character
 	UPROPERTY(BlueprintReadOnly)
 	class APlayerCharacter* PlayerCharacter = nullptr;
@@ -59,12 +80,22 @@ class UProjectileGunComponent : public USceneComponent
 	UFUNCTION()
 	virtual void SetInitialProjectileSpeed(FVector Direction, UProjectileMovementComponent* ProjectileMovementComponent);
 
-	//function to fire the projectile
+	//function to fire the projectile (returns nullptr for simulated projectiles)
 	UFUNCTION(BlueprintCallable)
 	virtual AActor* FireProjectile(FVector Direction);
 
-	//function to handle when the projectile hits something
+	//function to handle when the projectile hits something (the projectile is nullptr for simulated projectiles)
 	UFUNCTION()
 	virtual void OnProjectileHit(AActor* Projectile, AActor* OtherActor, FVector NormalImpulse, const FHitResult& Hit);
 
+	//function to handle when a simulated projectile's lifetime runs out
+	virtual void OnSimulatedProjectileExpired(const FVector& Location, const FRotator& Rotation);
+
+	//function to get rid of a projectile (returned to the projectile pool if it came from it, otherwise destroyed)
+	UFUNCTION(BlueprintCallable)
+	void ReleaseProjectile(AActor* Projectile) const;
+
+	//function to get how long a pooled projectile can fly before the pool releases it (0 = never)
+	virtual float GetPooledProjectileLifeTime() const;
+
 };
@@ -0,0 +1,74 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/GameplaySchedulerSubsystem.h"
+#include "ProjectilePoolSubsystem.generated.h"
+
+//struct for the inactive projectiles of a projectile class
+USTRUCT()
+struct FProjectilePool
+{
+	GENERATED_BODY()
+
+	//the inactive projectiles ready to be reused
+	UPROPERTY()
+	TArray<AActor*> FreeActors;
+};
+
+/**
+ * @class UProjectilePoolSubsystem
+ * @brief Keeps hidden, inactive projectile actors per projectile class so firing reuses them instead of spawning and destroying actors.
+ */
+UCLASS()
+class HILT_API UProjectilePoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	//function to spawn inactive projectiles of a class until the pool has at least the given number of them
+	void Prewarm(TSubclassOf<AActor> ProjectileClass, int32 Count);
+
+	//function to get an active projectile of a class at a location (reused from the pool if possible, otherwise spawned), the gun's hit bindings are removed when the projectile is released and the projectile is released when its life time runs out (0 = no expiry)
+	AActor* AcquireProjectile(TSubclassOf<AActor> ProjectileClass, const FVector& Location, const FRotator& Rotation, AActor* Owner, UObject* Gun, float LifeTime);
+
+	//function to return a projectile to its pool (projectiles that didn't come from a pool are destroyed)
+	void ReleaseProjectile(AActor* Projectile);
+
+	//function to get whether or not a projectile came from a pool
+	bool IsPooled(const AActor* Projectile) const;
+
+private:
+
+	//function to hide a projectile and stop its movement, collision, ticking and effects
+	static void DeactivateProjectile(AActor* Projectile);
+
+	//function to show a projectile and restart its movement, collision, ticking and effects
+	static void ActivateProjectile(AActor* Projectile, const FVector& Location, const FRotator& Rotation);
+
+	//function to spawn a projectile for a pool
+	AActor* SpawnPooledProjectile(TSubclassOf<AActor> ProjectileClass, const FVector& Location, const FRotator& Rotation);
+
+	//the pools by projectile class
+	UPROPERTY()
+	TMap<UClass*, FProjectilePool> Pools;
+
+	//struct for the state of a projectile spawned by a pool
+	struct FPooledProjectile
+	{
+		//whether or not the projectile is currently active
+		bool bIsActive = false;
+
+		//the gun that fired the projectile (its hit bindings are removed when the projectile is released)
+		TWeakObjectPtr<UObject> Gun;
+
+		//the timer that releases the projectile when its life time runs out
+		FGameplayTimerHandle ExpiryTimer;
+	};
+
+	//every projectile spawned by the pools
+	TMap<TObjectKey<AActor>, FPooledProjectile> PooledActors;
+};
@@ -0,0 +1,109 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SimulatedProjectileSubsystem.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UProjectileGunComponent;
+
+//struct for the settings of a simulated projectile
+USTRUCT(BlueprintType)
+struct FSimulatedProjectileParams
+{
+	GENERATED_BODY()
+
+	//the speed of the projectile when it's fired
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float InitialSpeed = 3000;
+
+	//the gravity scale of the projectile
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float GravityScale = 0;
+
+	//how long the projectile lasts before it expires (in seconds)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float LifeTime = 5;
+
+	//the radius of the sphere swept along the projectile's path (0 = line trace)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Radius = 10;
+
+	//the channel the projectile collides on
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_WorldDynamic;
+
+	//the mesh drawn for the projectile (drawn as an instance, nothing is drawn if not set)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	UStaticMesh* Mesh = nullptr;
+
+	//the scale of the mesh
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FVector MeshScale = FVector(1);
+};
+
+/**
+ * @class USimulatedProjectileSubsystem
+ * @brief Simulates projectiles without actors, stored as arrays of positions, velocities, gravity and lifetimes.
+ *
+ * Every projectile is moved and swept in one pass per tick and drawn as an instance of its mesh. Hits are reported
+ * through the firing gun's OnProjectileHit (with no projectile actor) and expiries through its OnSimulatedProjectileExpired.
+ */
+UCLASS()
+class HILT_API USimulatedProjectileSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	//constructor
+	USimulatedProjectileSubsystem();
+
+	//override(s)
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	//function to fire a simulated projectile for a gun
+	void FireProjectile(UProjectileGunComponent* Gun, const FVector& Location, const FVector& Velocity, const FSimulatedProjectileParams& Params);
+
+	//function to remove every simulated projectile (e.g. when the level restarts)
+	void ClearProjectiles();
+
+	//function to get the number of simulated projectiles
+	int32 GetNumProjectiles() const { return Locations.Num(); }
+
+private:
+
+	//function to remove a projectile (swaps the last projectile into its place)
+	void RemoveProjectile(int32 Index);
+
+	//function to get the index of the instanced mesh component of a mesh (creates it if needed, INDEX_NONE if there's no mesh)
+	int32 GetMeshIndex(UStaticMesh* Mesh);
+
+	//function to update the instances of the instanced mesh components to the projectile locations
+	void UpdateInstances();
+
+	//the state of every projectile (one array per value, the same index in every array is the same projectile)
+	TArray<FVector> Locations;
+	TArray<FVector> Velocities;
+	TArray<float> GravityZ;
+	TArray<float> RemainingLifeTimes;
+	TArray<float> Radii;
+	TArray<TEnumAsByte<ECollisionChannel>> TraceChannels;
+	TArray<int32> MeshIndices;
+	TArray<FVector> MeshScales;
+	TArray<TWeakObjectPtr<UProjectileGunComponent>> Guns;
+
+	//the actor holding the instanced mesh components
+	UPROPERTY()
+	AActor* InstanceActor = nullptr;
+
+	//the instanced mesh components (one per mesh)
+	UPROPERTY()
+	TArray<UInstancedStaticMeshComponent*> InstanceComponents;
+
+	//storage for the instance transforms of each mesh (kept between ticks so they don't reallocate)
+	TArray<TArray<FTransform>> InstanceTransforms;
+};
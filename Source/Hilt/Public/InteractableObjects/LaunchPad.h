@@ -3,10 +3,46 @@
 // Class includes
 #include "CoreMinimal.h"
 #include "InteractableObjects/BaseInteractableObject.h"
+#include "Core/GameplaySchedulerSubsystem.h"
 #include "LaunchPad.generated.h"
 
 // Forward Declaration`s
 
+// Baked launch of a launch pad (world space, updated when the pad is built or begins play)
+USTRUCT(BlueprintType)
+struct FLaunchProfile
+{
+	GENERATED_BODY()
+
+	// World space direction actors are thrown in
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FVector Direction = FVector::UpVector;
+
+	// Impulse applied to the player
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FVector Impulse = FVector::ZeroVector;
+
+	// Velocity the landing prediction launches from
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FVector LaunchVelocity = FVector::ZeroVector;
+
+	// Highest point of the predicted path
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FVector ApexLocation = FVector::ZeroVector;
+
+	// Where the predicted path hits the level
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FVector LandingLocation = FVector::ZeroVector;
+
+	// Time from the launch to the landing
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float FlightTime = 0.0f;
+
+	// Whether the predicted path hit the level before the prediction ran out
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bHasLanding = false;
+};
+
 /**
  * @class ALaunchPad.
  * @brief An interactable object that launches actors that enter the launch zone.
@@ -30,6 +66,18 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Variables")
 	float DefaultThrowStrength = 400000.0f;
 
+	// Launch speed the landing prediction is clamped to (the player's speed limit)
+	UPROPERTY(EditAnywhere, Category = "Variables|Prediction")
+	float PredictionMaxLaunchSpeed = 4000.0f;
+
+	// How long the landing prediction simulates for
+	UPROPERTY(EditAnywhere, Category = "Variables|Prediction")
+	float PredictionMaxTime = 10.0f;
+
+	// Baked launch of this pad (lets the HUD show destinations without simulating)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Variables|Prediction")
+	FLaunchProfile LaunchProfile;
+
 private:
 	//  ---------------------- Private Variable`s ---------------------
 	UPROPERTY(VisibleDefaultsOnly, Category = "Variables")
@@ -43,7 +91,7 @@ private:
 	// ------------- class Refs ------------
 
 	// ------------- Timer Handlers ------------
-	FTimerHandle MainTimerHandler;
+	FGameplayTimerHandle MainTimerHandler;
 
 	// VFX ------------------------------
 	UPROPERTY(EditAnywhere, Category = "VFX")
@@ -66,12 +114,17 @@ public:
 	ALaunchPad();
 
 	// Function`s ----------
+	virtual void OnConstruction(const FTransform& Transform) override;
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaTime) override;
 	virtual void RemoveLevelPresence() override;
 	virtual void AddLevelPresence() override;
 	void ResetCooldown();
 
+	// Bakes the launch direction, impulse and predicted path
+	UFUNCTION(BlueprintCallable)
+	void BakeLaunchProfile();
+
 	UFUNCTION(BlueprintCallable)
 	virtual void OnOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
 		UPrimitiveComponent* OtherComponent, int32 OtherBodyIndex,
@@ -86,7 +139,7 @@ public:
 private:
 	//  --------------------- Private Function`s ----------------------
 
-	FVector CalcThrowDirection();
+	FVector CalcThrowDirection() const;
 	void ThrowActor(AActor* _actor);
 	void CooldownComplete();
 
@@ -94,6 +147,8 @@ public:
 	//  --------------- Getter`s / Setter`s / Adder`s -----------------
 
 	// Getter`s -------
+	UFUNCTION(BlueprintPure)
+	const FLaunchProfile& GetLaunchProfile() const { return LaunchProfile; }
 
 	// Setter`s --------
 
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "InteractableObjects/BaseInteractableObject.h"
 #include "NPC/Components/GrappleableComponent.h"
+#include "Core/HiltTags.h"
 #include "PylonObjective.generated.h"
 
 /**
@@ -19,6 +20,10 @@ public:
 
 	bool DisableOnce = true;
 
+	// The type the objective registers with (completions and splits are reported with it)
+	UPROPERTY(EditAnywhere, Category = "Objective")
+	FName ObjectiveType = HiltTags::ObjectiveTag;
+
 private:
 	//  ---------------------- Private Variable`s ---------------------
 
@@ -51,7 +56,9 @@ public:
 	APylonObjective();
 
 	// Function`s ----------
+	virtual void PostInitializeComponents() override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 	virtual void RemoveLevelPresence() override;
 	virtual void AddLevelPresence() override;
@@ -64,6 +71,9 @@ public:
 private:
 	//  --------------------- Private Function`s ----------------------
 
+	// Called by the objective registry when the objectives are reset
+	UFUNCTION()
+	void OnObjectivesReset();
 
 
 public:
@@ -65,6 +65,10 @@ public:
 	//constructor
 	UGrappleableComponent();
 
+	//override(s)
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	//event called when the grappling actor starts grappling to this actor
 	UPROPERTY(BlueprintAssignable)
 	FOnStartGrapple OnStartGrappleEvent;
@@ -124,11 +124,11 @@ public:
 
 	//function to handle loading streaming levels
 	UFUNCTION(BlueprintCallable)
-	void ShowStreamingLevel(TArray<FName> LevelsToLoad);
+	void ShowStreamingLevel(const TArray<FName>& LevelsToLoad);
 
 	//function to handle
 	UFUNCTION(BlueprintCallable)
-	void HideStreamingLevel(TArray<FName> LevelsToHide);
+	void HideStreamingLevel(const TArray<FName>& LevelsToHide);
 
 	//input function for shooting the grappling hook
 	UFUNCTION()
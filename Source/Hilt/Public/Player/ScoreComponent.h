@@ -91,10 +91,28 @@ class HILT_API UScoreComponent : public UActorComponent
 
 public:
 
+	//delegate for when the score crosses into a new tier
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnScoreTierChanged, int32, NewTier, int32, OldTier);
+
+	//called when the score crosses into a new tier
+	UPROPERTY(BlueprintAssignable, Category = "Score")
+	FOnScoreTierChanged OnScoreTierChanged;
+
 	//the player's score
 	UPROPERTY(BlueprintReadOnly)
 	float Score = 0;
 
+	//the index of the score values for the current score (only updated when the score crosses a whole number)
+	UPROPERTY(BlueprintReadOnly)
+	int32 CurrentScoreTier = 0;
+
+	//the number of samples to bake the score degradation curve into
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Curves", meta = (ClampMin = "2", ClampMax = "4096"))
+	int32 DegradationTableResolution = 256;
+
+	//the baked values of the score degradation curve (evenly spaced from 0 to 1)
+	TArray<float> DegradationTable;
+
 	//the float curve to use for the player's score degradation over time (1 = 100% of the score, 0 = 0% of the score)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Curves")
 	UCurveFloat* ScoreDegradationCurve = nullptr;
@@ -143,6 +161,22 @@ public:
 
 	//function to get the current score values
 	UFUNCTION(BlueprintCallable)
-	FScoreValues GetCurrentScoreValues() const;
+	const FScoreValues& GetCurrentScoreValues() const;
+
+	//function to get the index of the current score values
+	UFUNCTION(BlueprintCallable)
+	int32 GetCurrentScoreTier() const;
+
+	//function to bake the score degradation curve into the degradation table (call again after changing the curve at runtime)
+	UFUNCTION(BlueprintCallable)
+	void BakeDegradationTable();
+
+	//function to get the degradation value for the current score from the degradation table
+	float GetDegradationValue() const;
+
+private:
+
+	//function to update the current score tier and call OnScoreTierChanged if it changed
+	void UpdateScoreTier();
 		
 };